@@ -72,6 +72,8 @@ class IncTarget(object):
     for (auto th_num : descriptor.parallel_strategy)
       std::cout << th_num << " ";
     std::cout << std::endl;
+    std::cout << "Blocking (L2 L3): " << descriptor.block_l2 << " "
+        << descriptor.block_l3 << std::endl;
   }
   else if (nullptr != this->cgraph_trans_ptr_%d_f_) {
     auto descriptor = this->cgraph_trans_ptr_%d_f_->get_descriptor();
@@ -83,6 +85,8 @@ class IncTarget(object):
     for (auto th_num : descriptor.parallel_strategy)
       std::cout << th_num << " ";
     std::cout << std::endl;
+    std::cout << "Blocking (L2 L3): " << descriptor.block_l2 << " "
+        << descriptor.block_l3 << std::endl;
   }''' % ('' if order == orders[0] else 'else ', order, order, order, order)
 
     # CGraphTransPackData's set data function content
@@ -95,6 +99,16 @@ class IncTarget(object):
     this->cgraph_trans_ptr_%d_f_->reset_data(in_data, out_data);''' % (
     '' if order == orders[0] else 'else ', order, order, order, order)
 
+    # CGraphTransPackData's footprint function content
+    footprint_content = ''
+    for order in orders:
+      footprint_content += '''
+  %sif (nullptr != this->cgraph_trans_ptr_%d_t_)
+    return sizeof(*this) + this->cgraph_trans_ptr_%d_t_->get_footprint();
+  else if (nullptr != this->cgraph_trans_ptr_%d_f_)
+    return sizeof(*this) + this->cgraph_trans_ptr_%d_f_->get_footprint();''' % (
+    '' if order == orders[0] else 'else ', order, order, order, order)
+
     # CGraphTransPackData's set thread ID function content
     set_thread_id_content = ''
     for order in orders:
@@ -186,7 +200,7 @@ CGraphTransPack<FloatType>::CGraphTransPack(const FloatType *in_data,
       update_(hptt::update_output(beta)) {
   // Create input size objects
   std::vector<TensorIdx> in_size_vec(in_size.begin(), in_size.end()),
-      in_outer_size_vec(in_outer_size.begin(), in_outer_size.begin());
+      in_outer_size_vec(in_outer_size.begin(), in_outer_size.end());
   if (0 == in_outer_size.size())
     in_outer_size_vec = in_size_vec;
 
@@ -218,6 +232,12 @@ HPTT_INL void CGraphTransPack<FloatType>::print_plan() {%s
 }
 
 
+template <typename FloatType>
+HPTT_INL std::size_t CGraphTransPack<FloatType>::get_footprint() const {%s
+  return sizeof(*this);
+}
+
+
 template <typename FloatType>
 HPTT_INL void CGraphTransPack<FloatType>::reset_data(const FloatType *in_data,
     FloatType *out_data) {%s
@@ -245,6 +265,7 @@ HPTT_INL void CGraphTransPack<FloatType>::exec_impl_() {
 
 #endif''' % (TARGET_PREFIX.upper(), TARGET_PREFIX.upper(),
     data_constructor_content, data_destructor_content, orders[0], orders[-1],
-    data_member_content, constructor_content, print_content, set_content,
+    data_member_content, constructor_content, print_content,
+    footprint_content, set_content,
     set_thread_id_content, unset_thread_id_content, exec_content_t,
     exec_content_f)]
@@ -45,10 +45,19 @@ public:
     using KernelPack = typename ParamType::KernelPack;
     Descriptor();
 
+    // Flatten into / restore from an integer sequence, used for persisting
+    // tuned descriptors. Decoding fails on malformed sequences.
+    std::vector<TensorIdx> encode() const;
+    bool decode(const std::vector<TensorIdx> &code);
+
     LoopOrderTrans<ORDER> loop_order;
     ParaStrategyTrans<ORDER> parallel_strategy;
     std::vector<std::array<LoopParamTrans<ORDER>, KernelPack::KERNEL_NUM>>
         description;
+
+    // Tile edges (in elements) applied on the two leading order loops, sized
+    // for L2 and L3 caches. Zero disables blocking at that level.
+    TensorIdx block_l2, block_l3;
   };
 
   CGraphTrans(const CGraphTrans &graph) = delete;
@@ -60,6 +69,7 @@ public:
   HPTT_INL void operator()();
 
   HPTT_INL Descriptor get_descriptor() const;
+  HPTT_INL std::size_t get_footprint() const;
   HPTT_INL void reset_data(const Float *data_in, Float *data_out);
   HPTT_INL void set_thread_ids(const std::vector<TensorInt> &thread_ids);
   HPTT_INL void unset_thread_ids();
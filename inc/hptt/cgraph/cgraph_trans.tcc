@@ -7,7 +7,9 @@
  */
 template <typename ParamType>
 CGraphTrans<ParamType>::Descriptor::Descriptor()
-    : description(1) {
+    : description(1),
+      block_l2(0),
+      block_l3(0) {
   for (TensorUInt order_idx = 0; order_idx < ORDER; ++order_idx)
     this->loop_order[order_idx] = order_idx;
   this->parallel_strategy.fill(1);
@@ -15,6 +17,69 @@ CGraphTrans<ParamType>::Descriptor::Descriptor()
 }
 
 
+template <typename ParamType>
+std::vector<TensorIdx> CGraphTrans<ParamType>::Descriptor::encode() const {
+  // Layout: loop order, parallel strategy, blocking, thread number, then
+  // begin/end/step of every loop for every kernel of every thread
+  std::vector<TensorIdx> code(this->loop_order.begin(),
+      this->loop_order.end());
+  code.insert(code.end(), this->parallel_strategy.begin(),
+      this->parallel_strategy.end());
+  code.push_back(this->block_l2);
+  code.push_back(this->block_l3);
+  code.push_back(this->description.size());
+  for (const auto &th_des : this->description)
+    for (const auto &loop : th_des) {
+      code.insert(code.end(), loop.loop_begin, loop.loop_begin + ORDER);
+      code.insert(code.end(), loop.loop_end, loop.loop_end + ORDER);
+      code.insert(code.end(), loop.loop_step, loop.loop_step + ORDER);
+    }
+  return code;
+}
+
+
+template <typename ParamType>
+bool CGraphTrans<ParamType>::Descriptor::decode(
+    const std::vector<TensorIdx> &code) {
+  constexpr TensorIdx head_len = 2 * ORDER + 3,
+      th_len = KernelPack::KERNEL_NUM * 3 * ORDER;
+  if (code.size() < head_len or 0 == code[head_len - 1] or
+      code.size() != head_len + code[head_len - 1] * th_len)
+    return false;
+
+  // Verify loop order
+  std::array<bool, ORDER> order_found{};
+  for (TensorUInt order_idx = 0; order_idx < ORDER; ++order_idx) {
+    if (code[order_idx] >= ORDER or order_found[code[order_idx]])
+      return false;
+    order_found[code[order_idx]] = true;
+  }
+
+  // Verify loop steps
+  for (auto step_iter = code.begin() + head_len + 2 * ORDER;
+      step_iter < code.end(); step_iter += 3 * ORDER)
+    if (step_iter + ORDER != std::find(step_iter, step_iter + ORDER, 0))
+      return false;
+
+  auto code_iter = code.begin();
+  std::copy(code_iter, code_iter + ORDER, this->loop_order.begin());
+  std::copy(code_iter + ORDER, code_iter + 2 * ORDER,
+      this->parallel_strategy.begin());
+  code_iter += 2 * ORDER;
+  this->block_l2 = *code_iter++;
+  this->block_l3 = *code_iter++;
+  this->description.resize(*code_iter++);
+  for (auto &th_des : this->description)
+    for (auto &loop : th_des) {
+      std::copy(code_iter, code_iter + ORDER, loop.loop_begin);
+      std::copy(code_iter + ORDER, code_iter + 2 * ORDER, loop.loop_end);
+      std::copy(code_iter + 2 * ORDER, code_iter + 3 * ORDER, loop.loop_step);
+      code_iter += 3 * ORDER;
+    }
+  return true;
+}
+
+
 /*
  * Implementation for class CGraphTrans
  */
@@ -61,6 +126,16 @@ CGraphTrans<ParamType>::get_descriptor() const {
 }
 
 
+template <typename ParamType>
+HPTT_INL std::size_t CGraphTrans<ParamType>::get_footprint() const {
+  // Graph and parameter, one operation per kernel per thread, and descriptor
+  return sizeof(*this) + sizeof(ParamType) + this->threads_
+      * Descriptor::KernelPack::KERNEL_NUM * sizeof(OpForTrans<ORDER>)
+      + this->descriptor_.description.size()
+      * sizeof(typename decltype(this->descriptor_.description)::value_type);
+}
+
+
 template <typename ParamType>
 HPTT_INL void CGraphTrans<ParamType>::reset_data(const Float *data_in,
     Float *data_out) {
@@ -113,6 +188,13 @@ void CGraphTrans<ParamType>::init(const Descriptor &descriptor) {
   this->descriptor_ = descriptor;
   this->operations_ = new OpForTrans<ORDER> [this->threads_];
 
+  // Locate the two leading order loops which are blocked for caches, in
+  // common leading case they are the two 2nd leading orders
+  const auto begin_idx = this->param_->begin_order_idx;
+  const auto block_in_idx = this->param_->is_common_leading()
+      ? begin_idx + 1 : begin_idx;
+  const auto block_out_idx = begin_idx + this->param_->perm[block_in_idx];
+
   // Initialize for loops' parameters and loop order
   // Set kernel index's end, leave two for scalar kernels
   auto &description = this->descriptor_.description;
@@ -120,13 +202,16 @@ void CGraphTrans<ParamType>::init(const Descriptor &descriptor) {
   for (TensorUInt th_idx = 0; th_idx < this->threads_; ++th_idx) {
     auto curr_oper = this->operations_ + th_idx;
     curr_oper->init(this->descriptor_.loop_order, description[th_idx][0],
-        this->param_->begin_order_idx, this->param_->perm);
+        begin_idx, this->param_->perm);
+    curr_oper->set_blocking(block_in_idx, block_out_idx,
+        this->descriptor_.block_l2, this->descriptor_.block_l3);
 
     for (TensorUInt kn_idx = 1; kn_idx < kn_idx_end; ++kn_idx) {
       curr_oper->next = new OpForTrans<ORDER>(this->descriptor_.loop_order,
-          description[th_idx][kn_idx], this->param_->begin_order_idx,
-          this->param_->perm);
+          description[th_idx][kn_idx], begin_idx, this->param_->perm);
       curr_oper = curr_oper->next;
+      curr_oper->set_blocking(block_in_idx, block_out_idx,
+          this->descriptor_.block_l2, this->descriptor_.block_l3);
     }
   }
 }
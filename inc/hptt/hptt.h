@@ -3,11 +3,13 @@
 #define HPTT_HPTT_H_
 
 #include <cstdint>
+#include <string>
 #include <vector>
 #include <memory>
 
 #include <hptt/types.h>
 #include <hptt/impl/hptt_trans.h>
+#include <hptt/impl/plan_cache.h>
 
 
 namespace hptt {
@@ -93,6 +95,73 @@ std::shared_ptr<trans_plan<FloatType>> create_plan(
     const std::vector<uint32_t> &out_outer_size = {});
 
 
+/**
+ * \brief Function for suggesting padded outer sizes of a tensor.
+ *
+ * \details When the distance between two rows of a tensor is a multiple of
+ *     2 KiB, the rows loaded by a transpose micro kernel map to the same L1
+ *     cache sets (4K aliasing) and performance may drop several times, e.g. on
+ *     power-of-two shapes. This function pads the outer sizes so that none of
+ *     the tensor's strides is critical. The padding is at most one cache line
+ *     per order. The result can be used to allocate the tensor and passed as
+ *     in_outer_size or out_outer_size to create_plan.
+ *
+ * \param[in] size Vector for describing size of each order of the tensor. For
+ *     the output tensor, its sizes (in output order) should be used.
+ *
+ * \return Suggested outer sizes, an empty vector is returned when size is
+ *     empty or contains zero.
+ */
+template <typename FloatType>
+std::vector<uint32_t> suggest_outer_size(const std::vector<uint32_t> &size);
+
+
+/**
+ * \brief Functions for loading and saving tuned plans ("wisdom").
+ *
+ * \details Every plan created with auto-tuning (tuning_timeout != 0.0) is
+ *     recorded in a process-wide store, keyed by data type, merged tensor sizes
+ *     and outer sizes, permutation, thread number, loaded library (avx2, avx,
+ *     common) and CPU model. Later create_plan calls for the same problem reuse
+ *     the recorded plan without tuning. These functions save the store to a
+ *     text file, or merge a saved file into the store.
+ *
+ *     When environment variable HPTT_WISDOM is set, its file is imported
+ *     before the store is first used, and it is used when path is empty.
+ *
+ * \param[in] path Wisdom file path, empty for the HPTT_WISDOM path.
+ *
+ * \return True on success; false when the file cannot be opened or is
+ *     malformed (the store is then unchanged), or the library cannot be loaded.
+ */
+bool import_wisdom(const std::string &path = "");
+bool export_wisdom(const std::string &path = "");
+
+
+/**
+ * \brief Functions for controlling the in-process plan cache.
+ *
+ * \details When the cache is enabled, create_plan keeps every created plan and
+ *     returns a kept plan for a later call with the same problem, rebound to
+ *     the new data with reset_data. Problems are compared after dropping size 1
+ *     orders and merging orders contiguous in both tensors, together with data
+ *     type, alpha, beta, thread number and whether tuning is requested. A kept
+ *     plan is only returned when no caller holds it, so a plan is never shared
+ *     by two callers. When the total footprint of kept plans exceeds the limit,
+ *     the least recently used plans are dropped.
+ *
+ * \param[in] limit Memory limit of kept plans in bytes. The cache is disabled
+ *     by default; setting the limit to 0 disables the cache and drops all kept
+ *     plans.
+ *
+ * \return get_plan_cache_stats returns hit, miss and eviction counters, the
+ *     number and total footprint of kept plans and the current limit.
+ */
+void set_plan_cache_limit(const std::size_t limit);
+PlanCacheStats get_plan_cache_stats();
+void clear_plan_cache();
+
+
 /*
  * Explicit template instantiation declaration for function create_trans_plan
  */
@@ -122,6 +191,19 @@ create_plan<DoubleComplex>(const DoubleComplex *, DoubleComplex *,
     const double, const std::vector<TensorUInt> &,
     const std::vector<TensorUInt> &);
 
+
+/*
+ * Explicit template instantiation declaration for function suggest_outer_size
+ */
+extern template std::vector<TensorUInt> suggest_outer_size<float>(
+    const std::vector<TensorUInt> &);
+extern template std::vector<TensorUInt> suggest_outer_size<double>(
+    const std::vector<TensorUInt> &);
+extern template std::vector<TensorUInt> suggest_outer_size<FloatComplex>(
+    const std::vector<TensorUInt> &);
+extern template std::vector<TensorUInt> suggest_outer_size<DoubleComplex>(
+    const std::vector<TensorUInt> &);
+
 }
 
 #endif // HPTT_HPTT_H_
@@ -2,6 +2,7 @@
 #ifndef HPTT_IMPL_HPTT_TRANS_H_
 #define HPTT_IMPL_HPTT_TRANS_H_
 
+#include <cstddef>
 #include <cstdint>
 
 #include <vector>
@@ -26,6 +27,7 @@ public:
   virtual void exec() = 0;
   virtual void operator()() = 0;
   virtual void print_plan() = 0;
+  virtual std::size_t get_footprint() const = 0;
   virtual void reset_data(const FloatType *in_data, FloatType *out_data) = 0;
   virtual void set_thread_ids(const std::vector<int32_t> &thread_ids) = 0;
   virtual void unset_thread_ids() = 0;
@@ -15,6 +15,7 @@
 #include <hptt/arch/compat.h>
 #include <hptt/impl/hptt_trans.h>
 #include <hptt/util/util_trans.h>
+#include <hptt/util/cost_model.h>
 #include <hptt/plan/plan_trans.h>
 #include <hptt/cgraph/cgraph_trans.h>
 #include <hptt/param/parameter_trans.h>
@@ -57,6 +58,7 @@ public:
   virtual void exec() final;
   virtual void operator()() final;
   virtual void print_plan() final;
+  virtual std::size_t get_footprint() const final;
   virtual void reset_data(const FloatType *in_data, FloatType *out_data) final;
   virtual void set_thread_ids(const std::vector<TensorInt> &thread_ids) final;
   virtual void unset_thread_ids() final;
@@ -92,8 +94,10 @@ CGraphTransPackBase<FloatType> *create_trans_plan_impl(const FloatType *in_data,
   constexpr auto heur_num = 5040;
 
   // Set auto-tuning amount and convert timeout from second to millisecond.
-  // 64 (loop orders) x 64 (parallelization strategies) will be tuned.
-  const auto tune_num = 0.0 == tuning_timeout ? 0 : 64;
+  // 64 (loop orders) x 64 (parallelization strategies) will be tuned. Without
+  // tuning, the learned cost model ranks 16 x 16 candidates when enabled.
+  const auto tune_num = 0.0 != tuning_timeout ? 64
+      : is_learned_model_enabled() ? 16 : 0;
   const auto tuning_timeout_ms = tuning_timeout * 1000;
 
   // Create transpose computational graph package
@@ -193,6 +197,10 @@ hptt::CGraphTransPackBase<hptt::DoubleComplex> *create_trans_plan_impl_z(
     const std::vector<hptt::TensorUInt> &in_outer_size,
     const std::vector<hptt::TensorUInt> &out_outer_size);
 
+
+bool import_wisdom_impl(const char *path);
+bool export_wisdom_impl(const char *path);
+
 }
 
 #endif // HPTT_IMPL_HPTT_TRANS_IMPL_H_
@@ -0,0 +1,69 @@
+#pragma once
+#ifndef HPTT_IMPL_PLAN_CACHE_H_
+#define HPTT_IMPL_PLAN_CACHE_H_
+
+#include <list>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+
+namespace hptt {
+
+/*
+ * Statistics of the process-wide plan cache
+ */
+struct PlanCacheStats {
+  uint64_t hits, misses, evictions;
+  std::size_t entries, bytes, limit;
+};
+
+
+/*
+ * Process-wide LRU cache of created plans, used by the loader. A cached plan
+ * is only handed out when no caller holds it, so concurrent callers of the
+ * same problem get distinct plans. Plans are evicted from the least recently
+ * used end when the total footprint exceeds the limit. A zero limit disables
+ * the cache.
+ */
+class PlanCache {
+public:
+  static PlanCache &get_cache();
+
+  PlanCache(const PlanCache &) = delete;
+  PlanCache &operator=(const PlanCache &) = delete;
+
+  bool is_enabled() const;
+  std::shared_ptr<void> acquire(const std::string &key);
+  void insert(const std::string &key, const std::shared_ptr<void> &plan,
+      const std::size_t bytes);
+
+  void set_limit(const std::size_t limit);
+  void clear();
+  PlanCacheStats get_stats() const;
+
+private:
+  struct Entry_ {
+    std::string key;
+    std::shared_ptr<void> plan;
+    std::size_t bytes;
+  };
+  using EntryIter_ = std::list<Entry_>::iterator;
+
+  PlanCache();
+
+  void evict_(const std::size_t limit);
+
+  mutable std::mutex lock_;
+  std::list<Entry_> entries_;    // Most recently used first
+  std::unordered_multimap<std::string, EntryIter_> index_;
+  std::size_t limit_, bytes_;
+  uint64_t hits_, misses_, evictions_;
+};
+
+}
+
+#endif // HPTT_IMPL_PLAN_CACHE_H_
@@ -27,6 +27,9 @@ public:
   HPTT_INL void init(const LoopOrderTrans<ORDER> &loop_order,
       const LoopParamTrans<ORDER> &loops, const TensorUInt begin_order_idx,
       const std::array<TensorUInt, ORDER> &perm);
+  HPTT_INL void set_blocking(const TensorUInt in_ld_idx,
+      const TensorUInt out_ld_idx, const TensorIdx block_l2,
+      const TensorIdx block_l3);
 
   template <typename MacroType,
             typename TensorType>
@@ -57,6 +60,11 @@ private:
   TensorIdx *loop_perm_idx_[ORDER];
   TensorIdx loop_begin_[ORDER], loop_end_[ORDER], loop_step_[ORDER];
   TensorIdx loop_order_[ORDER];
+
+  // Cache blocking on two loops, index 0 is the outer one in loop order
+  bool blocked_;
+  TensorUInt block_idx_[2];
+  TensorIdx block_l2_[2], block_l3_[2];
 };
 
 
@@ -42,6 +42,7 @@ void OpForTrans<ORDER>::init(const LoopOrderTrans<ORDER> &loop_order,
     const std::array<TensorUInt, ORDER> &perm) {
   // Initialize loops
   this->init_loops_(loop_order, loops);
+  this->blocked_ = false;
 
   // Initialize permutation array
   for (TensorUInt idx = 0; idx < begin_order_idx; ++idx)
@@ -52,14 +53,88 @@ void OpForTrans<ORDER>::init(const LoopOrderTrans<ORDER> &loop_order,
 }
 
 
+template <TensorUInt ORDER>
+HPTT_INL void OpForTrans<ORDER>::set_blocking(const TensorUInt in_ld_idx,
+    const TensorUInt out_ld_idx, const TensorIdx block_l2,
+    const TensorIdx block_l3) {
+  this->blocked_ = false;
+  if (this->loop_begin_[0] >= this->loop_end_[0] or
+      (0 == block_l2 and 0 == block_l3))
+    return;
+
+  // Outer blocked loop comes first in loop order
+  this->block_idx_[0] = in_ld_idx, this->block_idx_[1] = out_ld_idx;
+  if (std::find(this->loop_order_, this->loop_order_ + ORDER, out_ld_idx)
+      < std::find(this->loop_order_, this->loop_order_ + ORDER, in_ld_idx))
+    std::swap(this->block_idx_[0], this->block_idx_[1]);
+
+  // Round tile edges to multiples of loop step, L3 tiles are multiples of L2
+  // tiles. A disabled level covers the entire loop.
+  for (TensorUInt idx = 0; idx < 2; ++idx) {
+    const auto loop_idx = this->block_idx_[idx];
+    const auto step = this->loop_step_[loop_idx];
+    const auto extent = this->loop_end_[loop_idx] - this->loop_begin_[loop_idx];
+    if (this->loop_begin_[loop_idx] >= this->loop_end_[loop_idx])
+      return;
+
+    auto &l2 = this->block_l2_[idx], &l3 = this->block_l3_[idx];
+    l3 = 0 == block_l3 ? extent : std::max(step, block_l3 / step * step);
+    l2 = 0 == block_l2 ? l3 : std::max(step, block_l2 / step * step);
+    l2 = std::min(l2, l3), l3 = std::min(l3 / l2 * l2, extent);
+    l2 = std::min(l2, l3);
+    this->blocked_ = this->blocked_ or l2 < extent;
+  }
+}
+
+
 template <TensorUInt ORDER>
 template <typename MacroType,
           typename TensorType>
 HPTT_INL void OpForTrans<ORDER>::exec(const MacroType &macro_kernel,
     const TensorType &input_tensor, TensorType &output_tensor,
     const TensorIdx stride_in_outld, const TensorIdx stride_out_inld) {
-  this->unroller_(GenCounter<ORDER>(), macro_kernel, input_tensor,
-      output_tensor, stride_in_outld, stride_out_inld);
+  if (not this->blocked_) {
+    this->unroller_(GenCounter<ORDER>(), macro_kernel, input_tensor,
+        output_tensor, stride_in_outld, stride_out_inld);
+    return;
+  }
+
+  // Iterate over L3 tiles, then L2 tiles inside, and run the whole loop nest
+  // restricted to each L2 tile
+  const auto outer = this->block_idx_[0], inner = this->block_idx_[1];
+  const auto outer_begin = this->loop_begin_[outer],
+      outer_end = this->loop_end_[outer];
+  const auto inner_begin = this->loop_begin_[inner],
+      inner_end = this->loop_end_[inner];
+
+  for (auto l3_outer = outer_begin; l3_outer < outer_end;
+      l3_outer += this->block_l3_[0]) {
+    const auto l3_outer_end = std::min(l3_outer + this->block_l3_[0],
+        outer_end);
+    for (auto l3_inner = inner_begin; l3_inner < inner_end;
+        l3_inner += this->block_l3_[1]) {
+      const auto l3_inner_end = std::min(l3_inner + this->block_l3_[1],
+          inner_end);
+      for (auto l2_outer = l3_outer; l2_outer < l3_outer_end;
+          l2_outer += this->block_l2_[0]) {
+        this->loop_begin_[outer] = l2_outer;
+        this->loop_end_[outer] = std::min(l2_outer + this->block_l2_[0],
+            l3_outer_end);
+        for (auto l2_inner = l3_inner; l2_inner < l3_inner_end;
+            l2_inner += this->block_l2_[1]) {
+          this->loop_begin_[inner] = l2_inner;
+          this->loop_end_[inner] = std::min(l2_inner + this->block_l2_[1],
+              l3_inner_end);
+          this->unroller_(GenCounter<ORDER>(), macro_kernel, input_tensor,
+              output_tensor, stride_in_outld, stride_out_inld);
+        }
+      }
+    }
+  }
+
+  // Restore loop ranges
+  this->loop_begin_[outer] = outer_begin, this->loop_end_[outer] = outer_end;
+  this->loop_begin_[inner] = inner_begin, this->loop_end_[inner] = inner_end;
 }
 
 
@@ -73,6 +148,8 @@ void OpForTrans<ORDER>::init_disable_() {
 
   for (TensorUInt order_idx = 0; order_idx < ORDER; ++order_idx)
     this->loop_order_[order_idx] = order_idx;
+
+  this->blocked_ = false;
 }
 
 
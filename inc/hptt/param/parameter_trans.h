@@ -48,6 +48,7 @@ struct ParamTrans {
   using KernelPack = KernelPackTrans<Float, UPDATE_OUT>;
 
   static constexpr auto ORDER = TensorType::TENSOR_ORDER;
+  static constexpr bool UPDATE = UPDATE_OUT;
 
   ParamTrans(const TensorType &input_tensor, TensorType &output_tensor,
       const std::array<TensorUInt, ORDER> &perm, const Deduced alpha,
@@ -4,14 +4,21 @@
 
 #include <cfloat>
 
+#include <string>
 #include <vector>
 #include <memory>
+#include <numeric>
+#include <sstream>
 #include <utility>
+#include <algorithm>
+#include <type_traits>
 #include <initializer_list>
 
 #include <hptt/types.h>
 #include <hptt/util/util.h>
 #include <hptt/util/util_trans.h>
+#include <hptt/util/wisdom.h>
+#include <hptt/util/cost_model.h>
 #include <hptt/cgraph/cgraph_trans.h>
 #include <hptt/plan/plan_trans_util.h>
 
@@ -38,6 +45,7 @@ public:
 private:
   using Descriptor = typename CGraphTrans<ParamType>::Descriptor;
 
+  std::string wisdom_key_() const;
   Descriptor tuning_(const std::vector<Descriptor> &descriptors,
       const double tuning_timeout, const TensorUInt tune_times);
 
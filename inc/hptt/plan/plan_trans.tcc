@@ -18,8 +18,27 @@ PlanTrans<ParamType>::PlanTrans(
     : param_(param),
       optimizer_(param, num_threads, tune_loop_num, tune_para_num,
           heur_loop_num, heur_para_num),
-      optimal_descriptor_(this->tuning_(this->optimizer_.get_optimal(),
-          tuning_timeout, tune_times)) {
+      optimal_descriptor_() {
+  // Tuned plans are recorded as wisdom, a recorded plan skips tuning
+  const bool tuning = 0.0 != tuning_timeout;
+  auto &wisdom = Wisdom::get_wisdom();
+  const auto key = tuning ? this->wisdom_key_() : std::string();
+  std::vector<TensorIdx> code;
+  if (tuning and wisdom.lookup(key, code) and
+      this->optimal_descriptor_.decode(code))
+    return;
+
+  // Without tuning, the first (best ranked) candidate is used
+  const auto candidates = this->optimizer_.get_optimal();
+  if (not tuning and not candidates.empty()) {
+    this->optimal_descriptor_ = candidates.front();
+    return;
+  }
+
+  this->optimal_descriptor_ = this->tuning_(candidates, tuning_timeout,
+      tune_times);
+  if (tuning)
+    wisdom.insert(key, this->optimal_descriptor_.encode());
 }
 
 
@@ -30,11 +49,44 @@ CGraphTrans<ParamType> *PlanTrans<ParamType>::get_graph() {
 }
 
 
+template <typename ParamType>
+std::string PlanTrans<ParamType>::wisdom_key_() const {
+  // Key: data type, output updating, instruction set, CPU model, threads,
+  // merged sizes, input and output outer sizes and merged permutation
+  using Float = typename ParamType::Float;
+  const char type = std::is_same<float, Float>::value ? 's'
+      : std::is_same<double, Float>::value ? 'd'
+      : std::is_same<FloatComplex, Float>::value ? 'c' : 'z';
+  std::string cpu_model = hptt::get_cpu_model();
+  std::replace(cpu_model.begin(), cpu_model.end(), ' ', '_');
+
+  std::ostringstream key;
+  key << type << (ParamType::UPDATE ? "u" : "n") << " "
+      << hptt::get_arch_name() << " " << cpu_model << " t"
+      << this->optimizer_.get_threads();
+
+  const auto begin_idx = this->param_->begin_order_idx;
+  key << " n";
+  for (auto order_idx = begin_idx; order_idx < ParamType::ORDER; ++order_idx)
+    key << " " << this->param_->input_tensor.get_size(order_idx);
+  key << " i";
+  for (auto order_idx = begin_idx; order_idx < ParamType::ORDER; ++order_idx)
+    key << " " << this->param_->input_tensor.get_outer_size(order_idx);
+  key << " o";
+  for (auto order_idx = begin_idx; order_idx < ParamType::ORDER; ++order_idx)
+    key << " " << this->param_->output_tensor.get_outer_size(order_idx);
+  key << " p";
+  for (auto order_idx = begin_idx; order_idx < ParamType::ORDER; ++order_idx)
+    key << " " << this->param_->perm[order_idx];
+  return key.str();
+}
+
+
 template <typename ParamType>
 typename CGraphTrans<ParamType>::Descriptor PlanTrans<ParamType>::tuning_(
     const std::vector<typename CGraphTrans<ParamType>::Descriptor> &descriptors,
     const double tuning_timeout_ms, const TensorUInt tune_times) {
-  auto cand_num = descriptors.size();
+  const auto cand_num = static_cast<TensorUInt>(descriptors.size());
   if (1 == cand_num)
     return descriptors[0];
 
@@ -43,27 +95,62 @@ typename CGraphTrans<ParamType>::Descriptor PlanTrans<ParamType>::tuning_(
   auto beta = this->param_->beta;
   this->param_->set_coef(0.0, 1.0);
 
-  // Measure candidates
-  TensorUInt best_idx = 0;
-  auto best_time = DBL_MAX;
-  CGraphTrans<ParamType> candidate(this->param_, descriptors[best_idx]);
+  // Number of elements, for logging samples of the learned cost model
+  double elements = 1.0;
+  for (auto order_idx = this->param_->begin_order_idx;
+      order_idx < ParamType::ORDER; ++order_idx)
+    elements *= this->param_->input_tensor.get_size(order_idx);
 
-  // Set tuning timeout
-  TimerWrapper timer(tune_times);
+  // Caches are flushed between runs unless the tensors are too large to stay
+  // in the last level cache anyway
+  const auto &cache_info = hptt::get_cache_info();
+  const auto cache_size = cache_info.l3_size + cache_info.l2_size;
+  const auto data_size = 2.0 * elements * sizeof(typename ParamType::Float);
+  TimerWrapper timer(tune_times, data_size < 2.0 * cache_size
+      ? 2 * cache_size : 0);
   timer.start_countdown(tuning_timeout_ms);
-  for (auto cand_idx = best_idx; cand_idx < cand_num; ++cand_idx) {
-    candidate.init(descriptors[cand_idx]);
-    auto new_time = timer(candidate);
-
-    if (timer.is_timeout())
-      break;  // If timeout, then break
-    else if (new_time < best_time)
-      best_idx = cand_idx, best_time = new_time;
+
+  // Successive halving: every candidate is timed once, then the faster half
+  // by median is timed again with doubled runs, until one candidate is left or
+  // time is up. The result is the best median among the last round's
+  // candidates, which have the most samples.
+  CGraphTrans<ParamType> candidate(this->param_, descriptors[0]);
+  std::vector<std::vector<double>> samples(cand_num);
+  std::vector<double> medians(cand_num, DBL_MAX);
+  std::vector<TensorUInt> survivors(cand_num);
+  std::iota(survivors.begin(), survivors.end(), 0);
+  for (TensorUInt runs = 1; survivors.size() > 1 and not timer.is_timeout();
+      runs = std::min(2 * runs, std::max(tune_times, 1u))) {
+    for (auto cand_idx : survivors) {
+      candidate.init(descriptors[cand_idx]);
+      const auto times = timer.sample(runs, candidate);
+      if (times.empty())
+        break;
+      auto &cand_samples = samples[cand_idx];
+      cand_samples.insert(cand_samples.end(), times.begin(), times.end());
+      medians[cand_idx] = hptt::get_median(cand_samples);
+    }
+
+    // Unmeasured candidates are dropped in the first round only, later ones
+    // are kept with their medians from the previous round
+    std::stable_sort(survivors.begin(), survivors.end(),
+        [&medians] (const TensorUInt first, const TensorUInt second) {
+          return medians[first] < medians[second];
+        });
+    while (not survivors.empty() and samples[survivors.back()].empty())
+      survivors.pop_back();
+    if (not timer.is_timeout())
+      survivors.resize((survivors.size() + 1) / 2);
   }
 
+  for (TensorUInt cand_idx = 0; cand_idx < cand_num; ++cand_idx)
+    if (not samples[cand_idx].empty())
+      hptt::log_cost_sample(this->optimizer_.get_features(descriptors[cand_idx]),
+          medians[cand_idx] * 1.0e6 / elements);
+
   // Recover coefficients
   this->param_->set_coef(alpha, beta);
-  return descriptors[best_idx];
+  return survivors.empty() ? descriptors[0] : descriptors[survivors.front()];
 }
 
 
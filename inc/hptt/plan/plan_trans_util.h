@@ -19,6 +19,7 @@
 #include <hptt/types.h>
 #include <hptt/util/util.h>
 #include <hptt/util/util_trans.h>
+#include <hptt/util/cost_model.h>
 
 
 namespace hptt {
@@ -37,6 +38,7 @@ template <typename ParamType>
 class PlanTransOptimizer {
 public:
   using Descriptor = typename CGraphTrans<ParamType>::Descriptor;
+  using Float = typename ParamType::Float;
   static constexpr auto ORDER = ParamType::ORDER;
 
   PlanTransOptimizer(const std::shared_ptr<ParamType> &param,
@@ -45,6 +47,8 @@ public:
       const TensorInt heur_para_num);
 
   std::vector<Descriptor> get_optimal() const;
+  TensorUInt get_threads() const;
+  CostFeatures get_features(const Descriptor &candidate) const;
 
 private:
   struct LoopParaStrategy_ {
@@ -81,12 +85,16 @@ private:
   void init_parallel_rule_common_leading_();
   void init_parallel_heur_(const TensorInt tune_num, const TensorInt heur_num);
 
+  void init_blocking_(const bool tuning);
+  bool is_block_innermost_(const LoopOrderTrans<ORDER> &loop_order) const;
+
   double heur_loop_evaluator_(
       const LoopOrderTrans<ORDER> &target_loop_order) const;
   double heur_parallel_evaluator_(
       const ParaStrategyTrans<ORDER> &target_para) const;
 
   std::vector<Descriptor> gen_candidates_() const;
+  void gen_parallel_(Descriptor &candidate) const;
 
 
   std::shared_ptr<ParamType> param_;
@@ -97,14 +105,23 @@ private:
 
   std::vector<LoopOrderTrans<ORDER>> loop_order_candidates_;
   std::vector<ParaStrategyTrans<ORDER>> parallel_strategy_candidates_;
+  std::vector<std::pair<TensorIdx, TensorIdx>> block_candidates_;
   Descriptor template_descriptor_;
 
-  // Parameters for loop order heuristics
-  double heur_loop_penalty_begin, heur_loop_penalty_step;
-  double heur_loop_importance_begin, heur_loop_importance_scale;
-  double heur_loop_input_penalty_factor, heur_loop_output_penalty_factor;
+  // Parameters for loop order rule
   double heur_loop_in_ld_award, heur_loop_out_ld_award;
 
+  // Parameters for loop order heuristics, a memory level is described by its
+  // block size (cache line or page), capacity in bytes, miss cost and cost
+  // factor of output misses. Strides are in bytes, tile length is the largest
+  // macro kernel's length in elements.
+  struct MemLevel_ {
+    double block, capacity, cost, write_factor;
+  };
+  std::vector<MemLevel_> heur_loop_levels;
+  std::array<double, ORDER> heur_loop_in_stride, heur_loop_out_stride;
+  double heur_loop_tile_len;
+
   // Parameters for parallelization heuristics
   double heur_para_penalty_factor_cl, heur_para_penalty_factor_inld,
          heur_para_penalty_factor_outld, heur_para_cost_begin;
@@ -16,7 +16,7 @@ PlanTransOptimizer<ParamType>::PlanTransOptimizer(
       out_ld_idx_(this->param_->perm[this->in_ld_idx_] + this->in_ld_idx_),
       th_factor_map_(), avail_parallel_(),
       loop_order_candidates_(), parallel_strategy_candidates_(),
-      template_descriptor_() {
+      block_candidates_(), template_descriptor_() {
   if (nullptr == this->param_)
     return;
 
@@ -30,13 +30,95 @@ PlanTransOptimizer<ParamType>::get_optimal() const {
   // Check if parameter is nullptr
   if (nullptr == this->param_)
     return {};
-  return this->gen_candidates_();
+
+  // Rank candidates with the learned cost model when it's enabled
+  auto candidates = this->gen_candidates_();
+  if (is_learned_model_enabled() and candidates.size() > 1) {
+    std::vector<std::pair<double, TensorUInt>> ranks;
+    for (TensorUInt cand_idx = 0; cand_idx < candidates.size(); ++cand_idx)
+      ranks.emplace_back(hptt::predict_cost(
+          this->get_features(candidates[cand_idx])), cand_idx);
+    std::stable_sort(ranks.begin(), ranks.end(),
+        [] (const std::pair<double, TensorUInt> &a,
+            const std::pair<double, TensorUInt> &b) -> bool {
+            return a.first < b.first; });
+
+    std::vector<Descriptor> ranked;
+    for (const auto &rank : ranks)
+      ranked.emplace_back(std::move(candidates[rank.second]));
+    candidates = std::move(ranked);
+  }
+  return candidates;
+}
+
+
+template <typename ParamType>
+TensorUInt PlanTransOptimizer<ParamType>::get_threads() const {
+  return this->threads_;
+}
+
+
+template <typename ParamType>
+CostFeatures PlanTransOptimizer<ParamType>::get_features(
+    const Descriptor &candidate) const {
+  CostFeatures features;
+  features.fill(0.0);
+  if (nullptr == this->param_)
+    return features;
+
+  double elements = 1.0;
+  for (auto order_idx = this->in_ld_idx_; order_idx < ORDER; ++order_idx)
+    elements *= this->param_->input_tensor.get_size(order_idx);
+
+  // Loop depths of leading orders, 0 means inner most
+  TensorUInt in_ld_depth = 0, out_ld_depth = 0;
+  for (auto loop_idx = this->in_ld_idx_; loop_idx < ORDER; ++loop_idx) {
+    if (this->in_ld_idx_ == candidate.loop_order[loop_idx])
+      in_ld_depth = ORDER - 1 - loop_idx;
+    if (this->out_ld_idx_ == candidate.loop_order[loop_idx])
+      out_ld_depth = ORDER - 1 - loop_idx;
+  }
+
+  // Thread number and load imbalance of parallelization
+  double threads = 1.0, imbalance = 1.0;
+  for (auto loop_idx = this->in_ld_idx_; loop_idx < ORDER; ++loop_idx) {
+    const auto th_num = candidate.parallel_strategy[loop_idx];
+    const auto avail = this->avail_parallel_[loop_idx];
+    threads *= th_num;
+    imbalance *= static_cast<double>((avail + th_num - 1) / th_num * th_num)
+        / avail;
+  }
+
+  const auto critical_num
+      = (hptt::is_critical_stride<Float>(static_cast<TensorIdx>(
+          this->heur_loop_in_stride[this->out_ld_idx_]) / sizeof(Float))
+          ? 1.0 : 0.0)
+      + (hptt::is_critical_stride<Float>(static_cast<TensorIdx>(
+          this->heur_loop_out_stride[this->in_ld_idx_]) / sizeof(Float))
+          ? 1.0 : 0.0);
+
+  features = { 1.0, std::log2(elements), std::log2(sizeof(Float)),
+      static_cast<double>(this->param_->merged_order),
+      this->param_->is_common_leading() ? 1.0 : 0.0,
+      std::log2(this->param_->input_tensor.get_size(this->in_ld_idx_)),
+      std::log2(this->param_->input_tensor.get_size(this->out_ld_idx_)),
+      static_cast<double>(in_ld_depth), static_cast<double>(out_ld_depth),
+      std::log2(threads),
+      std::log2(candidate.parallel_strategy[this->in_ld_idx_]),
+      std::log2(candidate.parallel_strategy[this->out_ld_idx_]),
+      std::log2(imbalance),
+      std::log2(this->heur_loop_evaluator_(candidate.loop_order) / elements),
+      0 != candidate.block_l2 or 0 != candidate.block_l3 ? 1.0 : 0.0,
+      critical_num };
+  return features;
 }
 
 
 template <typename ParamType>
 void PlanTransOptimizer<ParamType>::init_(TensorInt tune_loop_num,
     TensorInt tune_para_num, TensorInt heur_loop_num, TensorInt heur_para_num) {
+  const bool tuning = 0 != tune_loop_num or 0 != tune_para_num;
+
   // Initialize all kinds of parameters and configurations
   this->init_config_();
 
@@ -80,6 +162,9 @@ void PlanTransOptimizer<ParamType>::init_(TensorInt tune_loop_num,
     this->parallel_strategy_candidates_.emplace_back(
         this->template_descriptor_.parallel_strategy);
   }
+
+  // Initialize cache blocking
+  this->init_blocking_(tuning);
 }
 
 
@@ -104,14 +189,36 @@ void PlanTransOptimizer<ParamType>::init_config_() {
 
 template <typename ParamType>
 void PlanTransOptimizer<ParamType>::init_loop_evaluator_param_() {
-  this->heur_loop_penalty_begin = 0.0;
-  this->heur_loop_penalty_step = 20.0;
-  this->heur_loop_importance_begin = 1.0;
-  this->heur_loop_importance_scale = 0.5;
-  this->heur_loop_input_penalty_factor = 1.0;
-  this->heur_loop_output_penalty_factor = 1.01;
   this->heur_loop_in_ld_award = 0.85;
   this->heur_loop_out_ld_award = 0.8;
+
+  // Memory levels of the cost model, half of a cache is assumed usable because
+  // of associativity conflicts. Miss costs are rough latencies (in cycles) of
+  // the next level. An output cache miss costs a read for ownership and a
+  // write back.
+  const auto &info = hptt::get_cache_info();
+  const double line = info.line_size, page = info.page_size;
+  this->heur_loop_levels = {
+      { line, 0.5 * info.l1d_size, 14.0, 2.0 },
+      { line, 0.5 * info.l2_size, 40.0, 2.0 },
+      { line, 0.5 * info.l3_size / info.l3_sharing, 200.0, 2.0 },
+      { page, page * info.dtlb_entries, 7.0, 1.0 },
+      { page, page * info.stlb_entries, 30.0, 1.0 } };
+  this->heur_loop_tile_len = static_cast<double>(
+      this->param_->get_kernel().knf_giant.get_ncont_len());
+
+  // Input and output strides of merged orders
+  const auto elem = static_cast<double>(sizeof(Float));
+  this->heur_loop_in_stride.fill(0.0);
+  this->heur_loop_out_stride.fill(0.0);
+  double in_stride = elem, out_stride = elem;
+  for (auto order_idx = this->in_ld_idx_; order_idx < ORDER; ++order_idx) {
+    this->heur_loop_in_stride[order_idx] = in_stride;
+    in_stride *= this->param_->input_tensor.get_outer_size(order_idx);
+    this->heur_loop_out_stride[this->param_->perm[order_idx]
+        + this->in_ld_idx_] = out_stride;
+    out_stride *= this->param_->output_tensor.get_outer_size(order_idx);
+  }
 }
 
 
@@ -420,10 +527,23 @@ void PlanTransOptimizer<ParamType>::init_vec_general_() {
   const auto cont_len = this->param_->input_tensor.get_size(this->in_ld_idx_);
   const auto ncont_len = this->param_->input_tensor.get_size(this->out_ld_idx_);
 
+  // A macro kernel reads input rows along output leading order and writes
+  // output rows along input leading order. When either stride is critical,
+  // those rows alias in L1, so macro kernels are narrowed to one micro kernel
+  // in that direction to keep the aliased rows within L1 associativity.
+  const bool cont_alias
+      = hptt::is_critical_stride<Float>(this->param_->stride_out_inld);
+  const bool ncont_alias
+      = hptt::is_critical_stride<Float>(this->param_->stride_in_outld);
+  const TensorUInt knh_cont_scale = cont_alias ? 1 : knh_scale,
+      knh_ncont_scale = ncont_alias ? 1 : knh_scale;
+
   if (cont_len >= knf_basic_len and ncont_len >= knf_basic_len) {
     // Leading orders can be vectorized by full kernel
     const TensorUInt knf_scale
         = this->param_->get_kernel().knf_giant.get_ncont_len() / knf_basic_len;
+    const TensorUInt knf_cont_scale = cont_alias ? 1 : knf_scale,
+        knf_ncont_scale = ncont_alias ? 1 : knf_scale;
 
     // Create rest thread number factors vector
     auto factor_map = this->th_factor_map_;
@@ -490,9 +610,9 @@ void PlanTransOptimizer<ParamType>::init_vec_general_() {
         big_core_ncont_num = knf_ncont_num - small_core_ncont_num;
 
     // Calculate big core region macro kernel's size
-    const auto big_core_kn_cont_size = hptt::select_kn_size(knf_scale,
+    const auto big_core_kn_cont_size = hptt::select_kn_size(knf_cont_scale,
         big_core_cont_num / cont_assigned);
-    const auto big_core_kn_ncont_size = hptt::select_kn_size(knf_scale,
+    const auto big_core_kn_ncont_size = hptt::select_kn_size(knf_ncont_scale,
         big_core_ncont_num / ncont_assigned);
 
     // Update available parallelism at input and output leading order loop
@@ -523,9 +643,9 @@ void PlanTransOptimizer<ParamType>::init_vec_general_() {
 
     // Vectorization on side region
     // Calculate side region macro kernel size
-    const auto horiz_side_kn_cont_size = hptt::select_kn_size(knh_scale,
+    const auto horiz_side_kn_cont_size = hptt::select_kn_size(knh_cont_scale,
         knf_cont_num * 2);
-    const auto vert_side_kn_ncont_size = hptt::select_kn_size(knh_scale,
+    const auto vert_side_kn_ncont_size = hptt::select_kn_size(knh_ncont_scale,
         knf_ncont_num * 2);
 
     // Vectorize vertical side region
@@ -561,15 +681,17 @@ void PlanTransOptimizer<ParamType>::init_vec_general_() {
     this->init_vec_deploy_kernels_(KernelTypeTrans::KERNEL_SCAL,
         cont_rest_len, ncont_rest_len, cont_len - cont_rest_len,
         ncont_len - ncont_rest_len, cont_rest_len, ncont_rest_len, 2);
-    this->param_->set_sca_wrapper_loop(knh_basic_len, knh_basic_len,
-        cont_rest_len, ncont_rest_len);
+    this->param_->set_sca_wrapper_loop(cont_rest_len, knh_basic_len,
+        knh_basic_len, ncont_rest_len);
   }
   else if (cont_len >= knh_basic_len and ncont_len >= knh_basic_len) {
     // Leading orders are too small for full kernels, use half kernels
     const TensorUInt knh_cont_num = cont_len / knh_basic_len,
         knh_ncont_num = ncont_len / knh_basic_len;
-    const auto kn_cont_size = hptt::select_kn_size(knh_scale, knh_cont_num);
-    const auto kn_ncont_size = hptt::select_kn_size(knh_scale, knh_ncont_num);
+    const auto kn_cont_size = hptt::select_kn_size(knh_cont_scale,
+        knh_cont_num);
+    const auto kn_ncont_size = hptt::select_kn_size(knh_ncont_scale,
+        knh_ncont_num);
 
     // Update available parallelism at input and output leading order loop
     this->avail_parallel_[this->in_ld_idx_] = knh_cont_num / kn_cont_size;
@@ -594,10 +716,10 @@ void PlanTransOptimizer<ParamType>::init_vec_general_() {
     // Set up scalar region
     this->init_vec_deploy_kernels_(KernelTypeTrans::KERNEL_SCAL,
         cont_len % knh_basic_len, ncont_len % knh_basic_len,
-        knh_ncont_num * knh_basic_len, knh_ncont_num * knh_basic_len,
+        knh_cont_num * knh_basic_len, knh_ncont_num * knh_basic_len,
         cont_len % knh_basic_len, ncont_len % knh_basic_len, 2);
-    this->param_->set_sca_wrapper_loop(kn_cont_size * knh_basic_len,
-        kn_ncont_size * knh_basic_len, cont_len % knh_basic_len,
+    this->param_->set_sca_wrapper_loop(cont_len % knh_basic_len,
+        kn_ncont_size * knh_basic_len, kn_cont_size * knh_basic_len,
         ncont_len % knh_basic_len);
   }
   else {
@@ -1104,43 +1226,157 @@ void PlanTransOptimizer<ParamType>::init_parallel_heur_(
 }
 
 
+template <typename ParamType>
+void PlanTransOptimizer<ParamType>::init_blocking_(const bool tuning) {
+  // Blocked loops are the two leading order loops, in common leading case they
+  // are the two 2nd leading orders, and every element in them moves a whole
+  // stride-1 line.
+  const bool cl = this->param_->is_common_leading();
+  const auto block_in_idx = cl ? this->in_ld_idx_ + 1 : this->in_ld_idx_;
+  const auto block_out_idx = this->in_ld_idx_
+      + this->param_->perm[block_in_idx];
+  const TensorIdx line_len = cl
+      ? this->param_->input_tensor.get_size(this->in_ld_idx_) : 1;
+  const TensorIdx extent = std::max(
+      this->param_->input_tensor.get_size(block_in_idx),
+      this->param_->input_tensor.get_size(block_out_idx));
+
+  // A square tile of input and its transposed output should occupy about half
+  // of the cache, the L3 cache is shared by the threads on the same socket
+  const auto &cache = hptt::get_cache_info();
+  const TensorIdx elem_bytes = 2 * sizeof(Float) * line_len;
+  const TensorIdx l3_threads = std::max<TensorIdx>(1,
+      std::min<TensorIdx>(this->threads_, cache.l3_sharing));
+  auto calc_edge = [extent, elem_bytes] (const TensorIdx cache_bytes) {
+    const auto edge = static_cast<TensorIdx>(
+        std::sqrt(static_cast<double>(cache_bytes / 2 / elem_bytes)));
+    return edge >= extent ? 0 : std::max<TensorIdx>(edge, 1);
+  };
+  const auto edge_l2 = calc_edge(cache.l2_size);
+  const auto edge_l3 = calc_edge(cache.l3_size / l3_threads);
+
+  this->block_candidates_.clear();
+  this->block_candidates_.emplace_back(edge_l2, edge_l3);
+  if (tuning and (0 != edge_l2 or 0 != edge_l3)) {
+    // Explore around the default tile sizes and the unblocked version
+    const std::pair<TensorIdx, TensorIdx> variants[] = {
+        { 0, 0 }, { edge_l2 * 2, edge_l3 }, { edge_l2 / 2, edge_l3 },
+        { edge_l2, 0 } };
+    for (const auto &variant : variants)
+      if (this->block_candidates_.end() == std::find(
+          this->block_candidates_.begin(), this->block_candidates_.end(),
+          variant))
+        this->block_candidates_.push_back(variant);
+  }
+}
+
+
+template <typename ParamType>
+bool PlanTransOptimizer<ParamType>::is_block_innermost_(
+    const LoopOrderTrans<ORDER> &loop_order) const {
+  // Blocking only pays off when the blocked loops are the inner most ones,
+  // the stride-1 loop in common leading case is not a real loop.
+  const bool cl = this->param_->is_common_leading();
+  const auto block_in_idx = cl ? this->in_ld_idx_ + 1 : this->in_ld_idx_;
+  const auto block_out_idx = this->in_ld_idx_
+      + this->param_->perm[block_in_idx];
+  TensorUInt found = 0;
+  for (auto loop_idx = static_cast<TensorInt>(ORDER) - 1;
+      loop_idx >= static_cast<TensorInt>(this->in_ld_idx_) and found < 2;
+      --loop_idx) {
+    const auto order_idx = loop_order[loop_idx];
+    if (block_in_idx == order_idx or block_out_idx == order_idx)
+      ++found;
+    else if (not cl or this->in_ld_idx_ != order_idx)
+      return false;
+  }
+  return 2 == found;
+}
+
+
 template <typename ParamType>
 double PlanTransOptimizer<ParamType>::heur_loop_evaluator_(
     const LoopOrderTrans<ORDER> &target_loop_order) const {
-  // Locate begin index
-  const auto merged_order = this->param_->merged_order;
+  // Build loop nest from inner most to outer most, a loop is described by its
+  // trip count, input and output strides. The macro kernel's tile forms the
+  // inner most loops, so that leading orders' loops step over tiles.
+  struct Loop {
+    double trip, in_stride, out_stride;
+  };
+  const auto elem = static_cast<double>(sizeof(Float));
+  const auto get_size = [this] (const TensorUInt order_idx) -> double {
+      return this->param_->input_tensor.get_size(order_idx); };
+  const auto in_tile = std::min(this->heur_loop_tile_len,
+      get_size(this->in_ld_idx_));
+  const auto out_tile = std::min(this->heur_loop_tile_len,
+      get_size(this->out_ld_idx_));
+
+  std::vector<Loop> nest;
+  if (this->param_->is_common_leading())
+    nest.push_back({ in_tile, elem, elem });
+  else {
+    nest.push_back({ in_tile, elem,
+        this->heur_loop_out_stride[this->in_ld_idx_] });
+    nest.push_back({ out_tile, this->heur_loop_in_stride[this->out_ld_idx_],
+        elem });
+  }
+  for (auto loop_idx = ORDER; loop_idx-- > this->in_ld_idx_; ) {
+    const auto order_idx = target_loop_order[loop_idx];
+    const auto step = order_idx == this->in_ld_idx_ ? in_tile
+        : order_idx == this->out_ld_idx_ ? out_tile : 1.0;
+    nest.push_back({ std::ceil(get_size(order_idx) / step),
+        step * this->heur_loop_in_stride[order_idx],
+        step * this->heur_loop_out_stride[order_idx] });
+  }
 
-  // Create loop penalty array
-  // [..., 2 * penalty_step, 1 * penalty_step, 0 * penalty_step]
-  std::vector<double> loop_penalty(merged_order, 0.0);
-  loop_penalty.back() = this->heur_loop_penalty_begin;
-  for (TensorInt loop_idx = merged_order - 2; loop_idx >= 0; --loop_idx)
-    loop_penalty[loop_idx] = loop_penalty[loop_idx + 1]
-        + this->heur_loop_penalty_step;
-
-  // Create target loop order's index map
-  // Key is a specific tensor order, values is its level in loop
-  std::vector<TensorUInt> target_map(merged_order, 0);
-  for (auto loop_idx = this->in_ld_idx_; loop_idx < ORDER; ++loop_idx)
-    target_map[target_loop_order[loop_idx] - this->in_ld_idx_]
-        = loop_idx - this->in_ld_idx_;
-
-  // Compute target loop order's costs
-  double loop_cost = 0.0, importance = this->heur_loop_importance_begin;
-  for (TensorUInt order_idx = 0; order_idx < merged_order;
-      ++order_idx, importance *= this->heur_loop_importance_scale) {
-    auto input_order_loop_pos = target_map[order_idx];
-    auto abs_idx = order_idx + this->in_ld_idx_;
-    auto output_order_loop_pos = target_map[this->param_->perm[abs_idx]];
-
-    auto input_order_penalty = loop_penalty[input_order_loop_pos];
-    auto output_order_penalty = loop_penalty[output_order_loop_pos];
-    loop_cost += importance
-        * (input_order_penalty * this->heur_loop_input_penalty_factor
-            + output_order_penalty * this->heur_loop_output_penalty_factor);
+  // Count distinct blocks of a tensor touched by the inner most depth loops.
+  // Loops are sorted by stride, loops continuing the contiguous run extend
+  // it, other loops multiply the number of touched runs.
+  const auto count_blocks = [&nest, elem] (const std::size_t depth,
+      const bool is_input, const double block) -> double {
+    std::array<std::pair<double, double>, ORDER + 2> dims;
+    std::size_t dim_num = 0;
+    for (std::size_t loop_idx = 0; loop_idx < depth; ++loop_idx)
+      if (nest[loop_idx].trip > 1.0)
+        dims[dim_num++] = std::make_pair(is_input ? nest[loop_idx].in_stride
+            : nest[loop_idx].out_stride, nest[loop_idx].trip);
+    std::sort(dims.begin(), dims.begin() + dim_num);
+
+    double run = elem, runs = 1.0;
+    for (std::size_t dim_idx = 0; dim_idx < dim_num; ++dim_idx) {
+      const auto &dim = dims[dim_idx];
+      if (dim.first <= run)
+        run += dim.first * (dim.second - 1.0);
+      else if (dim.first >= block)
+        runs *= dim.second;
+      else
+        runs *= std::min(dim.second,
+            (dim.first * (dim.second - 1.0) + block) / block);
+    }
+    return runs * std::ceil(run / block);
+  };
+
+  // At every memory level, find the deepest sub-nest whose footprint fits.
+  // Consecutive iterations of the loop around it share blocks, so its blocks
+  // are missed once per iteration of the remaining outer loops.
+  double cost = 0.0;
+  for (const auto &level : this->heur_loop_levels) {
+    std::size_t fit = 1;
+    while (fit < nest.size() and level.capacity >= level.block
+        * (count_blocks(fit + 1, true, level.block)
+            + count_blocks(fit + 1, false, level.block)))
+      ++fit;
+
+    const auto reuse = std::min(fit + 1, nest.size());
+    double repeat = 1.0;
+    for (auto loop_idx = reuse; loop_idx < nest.size(); ++loop_idx)
+      repeat *= nest[loop_idx].trip;
+
+    cost += level.cost * repeat * (count_blocks(reuse, true, level.block)
+        + level.write_factor * count_blocks(reuse, false, level.block));
   }
 
-  return loop_cost;
+  return cost;
 }
 
 
@@ -1185,79 +1421,25 @@ std::vector<typename CGraphTrans<ParamType>::Descriptor>
 PlanTransOptimizer<ParamType>::gen_candidates_() const {
   std::vector<typename CGraphTrans<ParamType>::Descriptor> candidates;
 
-  // Permute over different loop orders and parallelization strategies
+  // Permute over different loop orders, parallelization strategies and cache
+  // blocking tile sizes
   for (const auto &loop : this->loop_order_candidates_) {
+    const bool blockable = this->is_block_innermost_(loop);
+    const auto block_num = blockable ? this->block_candidates_.size() : 1;
     for (const auto &strategy : this->parallel_strategy_candidates_) {
-      // Create a new candidate from default single threaded descriptor
-      candidates.emplace_back(this->template_descriptor_);
-      candidates.back().loop_order = loop;
-      candidates.back().parallel_strategy = strategy;
-
-      // Parallelization
-      auto &des = candidates.back().description;
-
-      // Calculate actual thread number and resize description
-      const TensorUInt threads = std::accumulate(strategy.begin(),
-          strategy.end(), 1, std::multiplies<TensorUInt>());
-      des.resize(threads, des[0]);
-
-      // Parallelize
-      for (TensorUInt kn_idx = 0, kn_num = des[0].size(); kn_idx < kn_num;
-          ++kn_idx) {
-        // Skip disabled kernel
-        auto &kn_template = des[0][kn_idx];
-        if (kn_template.is_disabled())
-          continue;
-
-        for (TensorUInt loop_idx = this->in_ld_idx_, left_threads = threads;
-            loop_idx < ORDER and left_threads > 1; ++loop_idx) {
-          // Compute step times at current loop level
-          TensorIdx steps = (kn_template.loop_end[loop_idx]
-              - kn_template.loop_begin[loop_idx])
-              / kn_template.loop_step[loop_idx];
-
-          // Create vector to store steps for each thread at current loop level
-          const auto curr_para = strategy[loop_idx];
-          std::vector<TensorIdx> split_steps(curr_para,
-              curr_para <= steps ? steps / curr_para : 0);
-          std::for_each(split_steps.end() - steps % curr_para,
-              split_steps.end(), [] (TensorIdx &num) { ++num; });
-
-          // Create unit spans
-          std::vector<TensorIdx> unit_begins(left_threads),
-              unit_ends(left_threads);
-          for (TensorIdx cp_idx = 0,
-              begin_val = kn_template.loop_begin[loop_idx],
-              copies = left_threads / curr_para; cp_idx < curr_para; ++cp_idx) {
-            auto cp_beg = cp_idx * copies;
-            auto cp_end = cp_beg + copies;
-            auto end_val = begin_val
-                + split_steps[cp_idx] * kn_template.loop_step[loop_idx];
-            std::fill(unit_begins.begin() + cp_beg,
-                unit_begins.begin() + cp_end, begin_val);
-            std::fill(unit_ends.begin() + cp_beg, unit_ends.begin() + cp_end,
-                end_val);
-            begin_val = end_val;
-          }
-
-          // Assign rest index in loop to threads
-          std::vector<TensorIdx> begins(threads), ends(threads);
-          for (TensorUInt off = 0; off < threads; off += left_threads) {
-            std::copy(unit_begins.begin(), unit_begins.end(),
-                begins.begin() + off);
-            std::copy(unit_ends.begin(), unit_ends.end(), ends.begin() + off);
-          }
-
-          for (TensorUInt th_idx = 0; th_idx < threads; ++th_idx) {
-            des[th_idx][kn_idx].loop_begin[loop_idx] = begins[th_idx];
-            des[th_idx][kn_idx].loop_end[loop_idx] = ends[th_idx];
-            des[th_idx][kn_idx].loop_step[loop_idx]
-                = kn_template.loop_step[loop_idx];
-          }
-
-          // Update left thread number
-          left_threads /= curr_para;
+      for (TensorUInt block_idx = 0; block_idx < block_num; ++block_idx) {
+        // Create a new candidate from default single threaded descriptor
+        candidates.emplace_back(this->template_descriptor_);
+        candidates.back().loop_order = loop;
+        candidates.back().parallel_strategy = strategy;
+        if (blockable) {
+          const auto &block = this->block_candidates_[block_idx];
+          candidates.back().block_l2 = block.first;
+          candidates.back().block_l3 = block.second;
         }
+
+        // Parallelization
+        this->gen_parallel_(candidates.back());
       }
     }
   }
@@ -1266,6 +1448,103 @@ PlanTransOptimizer<ParamType>::gen_candidates_() const {
 }
 
 
+template <typename ParamType>
+void PlanTransOptimizer<ParamType>::gen_parallel_(
+    Descriptor &candidate) const {
+  const auto &strategy = candidate.parallel_strategy;
+  auto &des = candidate.description;
+
+  // Calculate actual thread number and resize description
+  const TensorUInt threads = std::accumulate(strategy.begin(),
+      strategy.end(), 1, std::multiplies<TensorUInt>());
+  des.resize(threads, des[0]);
+
+  // Thread boundaries along output leading order are rounded to whole cache
+  // lines, so that no two threads write the same line. A kernel region which
+  // does not begin at a line boundary is an edge region, it is not split along
+  // output leading order and goes to the last partition, which owns the line
+  // it continues. In common leading case, output leading order is never split.
+  const bool line_aware = this->in_ld_idx_ != this->out_ld_idx_;
+  const TensorIdx line_len = std::max<TensorIdx>(1,
+      hptt::get_cache_info().line_size / sizeof(Float));
+
+  // Parallelize
+  for (TensorUInt kn_idx = 0, kn_num = des[0].size(); kn_idx < kn_num;
+      ++kn_idx) {
+    // Skip disabled kernel
+    auto &kn_template = des[0][kn_idx];
+    if (kn_template.is_disabled())
+      continue;
+
+    for (TensorUInt loop_idx = this->in_ld_idx_, left_threads = threads;
+        loop_idx < ORDER and left_threads > 1; ++loop_idx) {
+      // Compute step times at current loop level
+      TensorIdx steps = (kn_template.loop_end[loop_idx]
+          - kn_template.loop_begin[loop_idx])
+          / kn_template.loop_step[loop_idx];
+
+      // Compute split unit (in steps) at current loop level
+      const auto step = kn_template.loop_step[loop_idx];
+      TensorIdx unit = 1;
+      bool is_edge = false;
+      if (line_aware and this->out_ld_idx_ == loop_idx) {
+        while (0 != unit * step % line_len)
+          ++unit;
+        is_edge = 0 != kn_template.loop_begin[loop_idx] % line_len;
+      }
+
+      // Create vector to store steps for each thread at current loop level,
+      // steps not filling a whole unit are given to the last partition
+      const auto curr_para = strategy[loop_idx];
+      const auto units = steps / unit;
+      std::vector<TensorIdx> split_steps(curr_para, 0);
+      if (not is_edge) {
+        std::fill(split_steps.begin(), split_steps.end(),
+            curr_para <= units ? units / curr_para * unit : 0);
+        std::for_each(split_steps.end() - units % curr_para,
+            split_steps.end(), [unit] (TensorIdx &num) { num += unit; });
+        split_steps.back() += steps % unit;
+      }
+      else
+        split_steps.back() = steps;
+
+      // Create unit spans
+      std::vector<TensorIdx> unit_begins(left_threads),
+          unit_ends(left_threads);
+      for (TensorIdx cp_idx = 0,
+          begin_val = kn_template.loop_begin[loop_idx],
+          copies = left_threads / curr_para; cp_idx < curr_para; ++cp_idx) {
+        auto cp_beg = cp_idx * copies;
+        auto cp_end = cp_beg + copies;
+        auto end_val = begin_val + split_steps[cp_idx] * step;
+        std::fill(unit_begins.begin() + cp_beg,
+            unit_begins.begin() + cp_end, begin_val);
+        std::fill(unit_ends.begin() + cp_beg, unit_ends.begin() + cp_end,
+            end_val);
+        begin_val = end_val;
+      }
+
+      // Assign rest index in loop to threads
+      std::vector<TensorIdx> begins(threads), ends(threads);
+      for (TensorUInt off = 0; off < threads; off += left_threads) {
+        std::copy(unit_begins.begin(), unit_begins.end(),
+            begins.begin() + off);
+        std::copy(unit_ends.begin(), unit_ends.end(), ends.begin() + off);
+      }
+
+      for (TensorUInt th_idx = 0; th_idx < threads; ++th_idx) {
+        des[th_idx][kn_idx].loop_begin[loop_idx] = begins[th_idx];
+        des[th_idx][kn_idx].loop_end[loop_idx] = ends[th_idx];
+        des[th_idx][kn_idx].loop_step[loop_idx] = step;
+      }
+
+      // Update left thread number
+      left_threads /= curr_para;
+    }
+  }
+}
+
+
 /*
  * Import explicit instantiation declaration for class PlanTransOptimizer, this
  * file should be generated by cmake script.
@@ -0,0 +1,34 @@
+#pragma once
+#ifndef HPTT_UTIL_COST_MODEL_H_
+#define HPTT_UTIL_COST_MODEL_H_
+
+#include <array>
+
+#include <hptt/types.h>
+
+
+namespace hptt {
+
+/*
+ * Learned cost model of transpose candidates. A candidate is described by a
+ * feature vector (see PlanTransOptimizer::get_features), the model predicts
+ * the logarithm of its time per element as a linear function of the features.
+ * Weights are trained offline from benchmark sweeps and compiled in, see
+ * test/benchmark/tools/train_cost_model.py.
+ *
+ * The model ranks candidates when environment variable HPTT_COST_MODEL is set
+ * to "learned". When HPTT_TUNING_LOG is set, every candidate timed during
+ * auto-tuning is appended to the file as a training sample: the features and
+ * the measured time per element (in nanoseconds), space separated.
+ */
+constexpr TensorUInt COST_MODEL_FEATURE_NUM = 16;
+using CostFeatures = std::array<double, COST_MODEL_FEATURE_NUM>;
+
+
+bool is_learned_model_enabled();
+double predict_cost(const CostFeatures &features);
+void log_cost_sample(const CostFeatures &features, const double time_ns);
+
+}
+
+#endif // HPTT_UTIL_COST_MODEL_H_
@@ -0,0 +1,19 @@
+#pragma once
+#ifndef HPTT_UTIL_COST_MODEL_WEIGHTS_H_
+#define HPTT_UTIL_COST_MODEL_WEIGHTS_H_
+
+/*
+ * Weights of the learned cost model, generated by
+ * test/benchmark/tools/train_cost_model.py. Do not edit.
+ */
+namespace hptt {
+
+constexpr double COST_MODEL_WEIGHTS[] = {
+  -2.5168909, 0.272444433, 0.956547224, -0.93322037,
+  -0.40049747, -0.223151385, -0.234663544, -0.0578647234,
+  0.0640613158, 0, 0, 0,
+  0, 0.170857792, 0.0143963754, 0 };
+
+}
+
+#endif // HPTT_UTIL_COST_MODEL_WEIGHTS_H_
@@ -4,6 +4,7 @@
 
 #include <cfloat>
 
+#include <string>
 #include <vector>
 #include <chrono>
 #include <utility>
@@ -31,26 +32,70 @@ template <bool COND,
 using Enable = typename std::enable_if<COND, Type>::type;
 
 
+/*
+ * Timer for auto-tuning. A measurement runs the target several times and
+ * returns the median time in milliseconds, or -1.0 on timeout. When a flush
+ * size is given, caches are flushed before every run so that a candidate does
+ * not benefit from data left by the previous one. Time is read from the
+ * steady clock, or from the calibrated time stamp counter when environment
+ * variable HPTT_TUNING_TIMER is "tsc".
+ */
 class TimerWrapper {
 public:
-  TimerWrapper(const TensorUInt times);
+  TimerWrapper(const TensorUInt times, const TensorIdx flush_size = 0);
 
   template <typename Callable,
             typename... Args>
   double operator()(Callable &target, Args&&... args);
 
+  template <typename Callable,
+            typename... Args>
+  std::vector<double> sample(const TensorUInt times, Callable &target,
+      Args&&... args);
+
   void start_countdown(const double timeout);
   bool is_timeout() const;
 
 private:
-  using Duration_ = std::chrono::duration<double, std::milli>;
+  void flush_cache_();
+  double now_() const;
 
   const TensorUInt times_;
-  double timeout_;
-  std::chrono::time_point<std::chrono::high_resolution_clock> countdown_begin_;
+  const bool use_tsc_;
+  double timeout_, countdown_begin_;
+  std::vector<double> flush_buffer_;
 };
 
 
+double get_median(std::vector<double> values);
+
+
+/*
+ * Cache geometry of the running CPU, detected once from CPUID leaf 4 (or leaf
+ * 0x8000001D on AMD). Sizes are in bytes, l3_sharing is the number of logical
+ * processors sharing the last level cache. TLB entry numbers are for 4 KiB
+ * pages, detected from leaf 0x18 (or leaves 0x80000005 and 0x80000006 on AMD).
+ */
+struct CacheInfo {
+  CacheInfo();
+
+  TensorIdx l1d_size, l2_size, l3_size;
+  TensorUInt line_size, l3_sharing;
+  TensorIdx page_size, dtlb_entries, stlb_entries;
+};
+
+
+const CacheInfo &get_cache_info();
+
+
+/*
+ * Processor brand string (empty if unavailable) and instruction set of the
+ * loaded library (e.g. "avx2"), together they identify the tuning target.
+ */
+const std::string &get_cpu_model();
+const char *get_arch_name();
+
+
 template <typename ValType>
 struct ModCmp {
   bool operator()(const ValType &first, const ValType &second);
@@ -10,21 +10,25 @@ template <typename Callable,
 double TimerWrapper::operator()(Callable &target, Args&&... args) {
   if (0 == this->times_)
     return 0.0;
-  else if (this->is_timeout())
-    return -1.0;
 
-  double result = DBL_MAX;
-  for (TensorUInt idx = 0; idx < this->times_ and not this->is_timeout();
-      ++idx) {
-    auto start = std::chrono::high_resolution_clock::now();
+  const auto result = this->sample(this->times_, target,
+      std::forward<Args>(args)...);
+  return result.empty() ? -1.0 : hptt::get_median(result);
+}
+
+
+template <typename Callable,
+          typename... Args>
+std::vector<double> TimerWrapper::sample(const TensorUInt times,
+    Callable &target, Args&&... args) {
+  std::vector<double> result;
+  for (TensorUInt idx = 0; idx < times and not this->is_timeout(); ++idx) {
+    this->flush_cache_();
+    const auto start = this->now_();
     target(std::forward<Args>(args)...);
-    auto duration = std::chrono::duration_cast<Duration_>(
-        std::chrono::high_resolution_clock::now() - start);
-    if (duration.count() < result)
-      result = duration.count();
+    result.push_back(this->now_() - start);
   }
-
-  return DBL_MAX == result ? -1.0 : result;
+  return result;
 }
 
 
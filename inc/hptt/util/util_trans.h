@@ -52,6 +52,14 @@ TensorUInt select_kn_size(TensorUInt size_upper_bound,
     const TensorUInt chunk_size);
 
 
+/*
+ * Rows whose stride is a multiple of 2 KiB fold into at most two 4 KiB page
+ * offsets, so the rows loaded by one micro kernel alias in the same L1 sets.
+ */
+template <typename FloatType>
+bool is_critical_stride(const TensorIdx stride);
+
+
 /*
  * Import implementation
  */
@@ -33,6 +33,15 @@ bool LoopParamTrans<ORDER>::is_disabled() const {
 }
 
 
+/*
+ * Implementation for function is_critical_stride
+ */
+template <typename FloatType>
+bool is_critical_stride(const TensorIdx stride) {
+  return 0 == stride * sizeof(FloatType) % 2048;
+}
+
+
 /*
  * Explicit template instantiation declaration for function calc_tp_trans
  */
@@ -0,0 +1,46 @@
+#pragma once
+#ifndef HPTT_UTIL_WISDOM_H_
+#define HPTT_UTIL_WISDOM_H_
+
+#include <mutex>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include <hptt/types.h>
+
+
+namespace hptt {
+
+/*
+ * Process-wide store of tuned plans ("wisdom"). Each entry maps a problem key
+ * to an encoded descriptor. Entries are kept in memory and can be saved to or
+ * loaded from a text file. When environment variable HPTT_WISDOM is set, its
+ * file is imported at first use and is the default path for import/export.
+ */
+class Wisdom {
+public:
+  static Wisdom &get_wisdom();
+
+  Wisdom(const Wisdom &) = delete;
+  Wisdom &operator=(const Wisdom &) = delete;
+
+  bool lookup(const std::string &key, std::vector<TensorIdx> &code) const;
+  void insert(const std::string &key, const std::vector<TensorIdx> &code);
+
+  bool import_file(const std::string &path);
+  bool export_file(const std::string &path) const;
+
+private:
+  Wisdom();
+
+  std::string resolve_path_(const std::string &path) const;
+
+  mutable std::mutex lock_;
+  std::unordered_map<std::string, std::vector<TensorIdx>> entries_;
+  std::string default_path_;
+};
+
+}
+
+#endif // HPTT_UTIL_WISDOM_H_
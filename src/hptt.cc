@@ -1,15 +1,76 @@
 #include <hptt/hptt.h>
 
+#include <string>
 #include <vector>
 #include <memory>
+#include <sstream>
+#include <algorithm>
+#include <type_traits>
 
 #include <hptt/types.h>
 #include <hptt/arch/arch.h>
+#include <hptt/util/util_trans.h>
 #include <hptt/impl/hptt_trans.h>
+#include <hptt/impl/plan_cache.h>
 
 
 namespace hptt {
 
+/*
+ * Implementation of function plan_cache_key, it builds the plan cache key of a
+ * problem. Orders are described by size, input stride and output stride. Size
+ * 1 orders are dropped and an order is merged into its predecessor when both
+ * of its strides continue the predecessor's, so that problems differing only
+ * in such orders share one key.
+ */
+template <typename FloatType>
+std::string plan_cache_key(const std::vector<TensorUInt> &in_size,
+    const std::vector<TensorUInt> &perm,
+    const DeducedFloatType<FloatType> alpha,
+    const DeducedFloatType<FloatType> beta, const TensorUInt num_threads,
+    const double tuning_timeout, const std::vector<TensorUInt> &in_outer_size,
+    const std::vector<TensorUInt> &out_outer_size) {
+  const auto order = static_cast<TensorUInt>(perm.size());
+  const auto &in_outer = in_outer_size.empty() ? in_size : in_outer_size;
+
+  std::vector<TensorIdx> in_stride(order), out_stride(order);
+  for (TensorUInt order_idx = 0, stride = 1; order_idx < order; ++order_idx) {
+    in_stride[order_idx] = stride;
+    stride *= in_outer[order_idx];
+  }
+  for (TensorUInt order_idx = 0, stride = 1; order_idx < order; ++order_idx) {
+    out_stride[perm[order_idx]] = stride;
+    stride *= out_outer_size.empty() ? in_size[perm[order_idx]]
+        : out_outer_size[order_idx];
+  }
+
+  struct Dim { TensorIdx size, in_stride, out_stride; };
+  std::vector<Dim> dims;
+  for (TensorUInt order_idx = 0; order_idx < order; ++order_idx) {
+    if (1 == in_size[order_idx])
+      continue;
+    if (not dims.empty()) {
+      auto &last = dims.back();
+      if (last.in_stride * last.size == in_stride[order_idx] and
+          last.out_stride * last.size == out_stride[order_idx]) {
+        last.size *= in_size[order_idx];
+        continue;
+      }
+    }
+    dims.push_back(Dim{ in_size[order_idx], in_stride[order_idx],
+        out_stride[order_idx] });
+  }
+
+  std::ostringstream key;
+  key << sizeof(FloatType) << (std::is_floating_point<FloatType>::value
+      ? 'r' : 'c') << ' ' << num_threads << ' ' << (0.0 != tuning_timeout)
+      << ' ' << std::hexfloat << alpha << ' ' << beta;
+  for (const auto &dim : dims)
+    key << ' ' << dim.size << ':' << dim.in_stride << ':' << dim.out_stride;
+  return key.str();
+}
+
+
 /*
  * Implementation of function create_cgraph_trans
  */
@@ -43,7 +104,7 @@ std::shared_ptr<CGraphTransPackBase<FloatType>> create_plan(
     if (0 == in_size[order_idx] or (not in_outer_size.empty() and
         in_outer_size[order_idx] < in_size[order_idx]) or
             (not out_outer_size.empty() and
-            out_outer_size[perm[order_idx]] < in_size[order_idx]))
+            out_outer_size[order_idx] < in_size[perm[order_idx]]))
       return nullptr;
 
   // Check permutation array
@@ -55,6 +116,20 @@ std::shared_ptr<CGraphTransPackBase<FloatType>> create_plan(
       perm_verify_map[order_idx] = true;
   }
 
+  // Reuse an idle cached plan of the same problem
+  auto &cache = PlanCache::get_cache();
+  std::string cache_key;
+  if (cache.is_enabled()) {
+    cache_key = plan_cache_key<FloatType>(in_size, perm, alpha, beta,
+        num_threads, tuning_timeout, in_outer_size, out_outer_size);
+    auto cached_plan = std::static_pointer_cast<CGraphTransPackBase<FloatType>>(
+        cache.acquire(cache_key));
+    if (nullptr != cached_plan) {
+      cached_plan->reset_data(in_data, out_data);
+      return cached_plan;
+    }
+  }
+
   // Locate function
   using FuncType_ = CGraphTransPackBase<FloatType> *(*)(const FloatType *,
       FloatType *, const TensorUInt, const std::vector<TensorUInt> &,
@@ -85,11 +160,84 @@ std::shared_ptr<CGraphTransPackBase<FloatType>> create_plan(
 
   if (nullptr == raw_func_trans)
     return nullptr;
-  else
-    return std::shared_ptr<CGraphTransPackBase<FloatType>>(
-        reinterpret_cast<FuncType_>(raw_func_trans)(in_data, out_data, order,
-        in_size, perm, alpha, beta, num_threads, tuning_timeout, in_outer_size,
-        out_outer_size));
+
+  std::shared_ptr<CGraphTransPackBase<FloatType>> plan(
+      reinterpret_cast<FuncType_>(raw_func_trans)(in_data, out_data, order,
+      in_size, perm, alpha, beta, num_threads, tuning_timeout, in_outer_size,
+      out_outer_size));
+  if (nullptr != plan and not cache_key.empty())
+    cache.insert(cache_key, plan, plan->get_footprint());
+  return plan;
+}
+
+
+/*
+ * Implementation of function suggest_outer_size
+ */
+template <typename FloatType>
+std::vector<TensorUInt> suggest_outer_size(
+    const std::vector<TensorUInt> &size) {
+  if (size.empty() or
+      size.end() != std::find(size.begin(), size.end(), 0))
+    return {};
+
+  // Pad one order at a time, so that the stride of the next order is not
+  // critical. Padding starts from one cache line and is halved until the
+  // stride is safe, one element always works because the current stride is
+  // already safe.
+  constexpr TensorUInt line_len = 64 / sizeof(FloatType);
+  std::vector<TensorUInt> outer_size(size);
+  TensorIdx stride = 1;
+  for (TensorUInt order_idx = 0; order_idx + 1 < size.size(); ++order_idx) {
+    auto &outer = outer_size[order_idx];
+    if (hptt::is_critical_stride<FloatType>(stride * outer)) {
+      auto pad = line_len;
+      while (pad > 1 and
+          hptt::is_critical_stride<FloatType>(stride * (outer + pad)))
+        pad /= 2;
+      outer += pad;
+    }
+    stride *= outer;
+  }
+
+  return outer_size;
+}
+
+
+/*
+ * Implementation of function import_wisdom and export_wisdom
+ */
+bool import_wisdom(const std::string &path) {
+  using FuncType_ = bool (*)(const char *);
+  auto raw_func = LibLoader::get_loader().dlsym("import_wisdom_impl");
+  return nullptr != raw_func and
+      reinterpret_cast<FuncType_>(raw_func)(path.c_str());
+}
+
+
+bool export_wisdom(const std::string &path) {
+  using FuncType_ = bool (*)(const char *);
+  auto raw_func = LibLoader::get_loader().dlsym("export_wisdom_impl");
+  return nullptr != raw_func and
+      reinterpret_cast<FuncType_>(raw_func)(path.c_str());
+}
+
+
+/*
+ * Implementation of plan cache functions
+ */
+void set_plan_cache_limit(const std::size_t limit) {
+  PlanCache::get_cache().set_limit(limit);
+}
+
+
+PlanCacheStats get_plan_cache_stats() {
+  return PlanCache::get_cache().get_stats();
+}
+
+
+void clear_plan_cache() {
+  PlanCache::get_cache().clear();
 }
 
 
@@ -122,4 +270,17 @@ create_plan<DoubleComplex>(const DoubleComplex *, DoubleComplex *,
     const double, const std::vector<TensorUInt> &,
     const std::vector<TensorUInt> &);
 
+
+/*
+ * Explicit template instantiation definition for function suggest_outer_size
+ */
+template std::vector<TensorUInt> suggest_outer_size<float>(
+    const std::vector<TensorUInt> &);
+template std::vector<TensorUInt> suggest_outer_size<double>(
+    const std::vector<TensorUInt> &);
+template std::vector<TensorUInt> suggest_outer_size<FloatComplex>(
+    const std::vector<TensorUInt> &);
+template std::vector<TensorUInt> suggest_outer_size<DoubleComplex>(
+    const std::vector<TensorUInt> &);
+
 }
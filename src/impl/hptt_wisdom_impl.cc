@@ -0,0 +1,13 @@
+#include <hptt/impl/hptt_trans_impl.h>
+
+#include <hptt/util/wisdom.h>
+
+
+bool import_wisdom_impl(const char *path) {
+  return hptt::Wisdom::get_wisdom().import_file(path);
+}
+
+
+bool export_wisdom_impl(const char *path) {
+  return hptt::Wisdom::get_wisdom().export_file(path);
+}
@@ -57,8 +57,10 @@ void MacroTrans<MicroKernel, SIZE_IN_INLD, SIZE_IN_OUTLD>::exec(
   // Prefetching
   using FloatType = typename MicroKernel::Float;
   constexpr TensorUInt NUM_IN_OUTLD = MicroKernel::KN_WIDTH * SIZE_IN_OUTLD;
+  // Streaming stores need every output row aligned, not only the first one
   auto USE_STREAMING = not MicroKernel::UPDATE and
       hptt::check_aligned<FloatType>(data_out) and
+      hptt::check_aligned<FloatType>(data_out + stride_out_inld) and
       MicroKernel::check_stream(NUM_IN_OUTLD);
 
   if (USE_STREAMING) {
@@ -233,7 +235,8 @@ void MacroTransScalar<FloatType, UPDATE_OUT>::exec(
       const TensorIdx offset_out = this->stride_out_outld_ * out_idx;
 
       for (TensorUInt in_idx = 0; in_idx < this->size_kn_inld_; ++in_idx)
-        *(data_out + offset_in + this->stride_out_inld_ * in_idx) = this->alpha_
+        *(data_out + offset_out + this->stride_out_inld_ * in_idx)
+            = this->alpha_
             * *(data_in + offset_in + this->stride_in_inld_ * in_idx)
             + this->beta_
             * *(data_out + offset_out + this->stride_out_inld_ * in_idx);
@@ -245,7 +248,8 @@ void MacroTransScalar<FloatType, UPDATE_OUT>::exec(
       const TensorIdx offset_out = this->stride_out_outld_ * out_idx;
 
       for (TensorUInt in_idx = 0; in_idx < this->size_kn_inld_; ++in_idx)
-        *(data_out + offset_in + this->stride_out_inld_ * in_idx) = this->alpha_
+        *(data_out + offset_out + this->stride_out_inld_ * in_idx)
+            = this->alpha_
             * *(data_in + offset_in + this->stride_in_inld_ * in_idx);
     }
   }
@@ -0,0 +1,105 @@
+#include <hptt/impl/plan_cache.h>
+
+#include <list>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+
+namespace hptt {
+
+/*
+ * Implementation for class PlanCache
+ */
+PlanCache &PlanCache::get_cache() {
+  static PlanCache cache;
+  return cache;
+}
+
+
+PlanCache::PlanCache()
+    : lock_(), entries_(), index_(), limit_(0), bytes_(0), hits_(0),
+      misses_(0), evictions_(0) {
+}
+
+
+bool PlanCache::is_enabled() const {
+  std::lock_guard<std::mutex> guard(this->lock_);
+  return 0 != this->limit_;
+}
+
+
+std::shared_ptr<void> PlanCache::acquire(const std::string &key) {
+  std::lock_guard<std::mutex> guard(this->lock_);
+
+  // Only the cache itself may hold an idle plan. Under the lock, nobody else
+  // can obtain a new reference to it, so the check is reliable.
+  const auto range = this->index_.equal_range(key);
+  for (auto iter = range.first; iter != range.second; ++iter) {
+    auto entry = iter->second;
+    if (1 == entry->plan.use_count()) {
+      this->entries_.splice(this->entries_.begin(), this->entries_, entry);
+      ++this->hits_;
+      return entry->plan;
+    }
+  }
+
+  ++this->misses_;
+  return nullptr;
+}
+
+
+void PlanCache::insert(const std::string &key,
+    const std::shared_ptr<void> &plan, const std::size_t bytes) {
+  std::lock_guard<std::mutex> guard(this->lock_);
+  if (0 == this->limit_ or bytes > this->limit_)
+    return;
+
+  this->evict_(this->limit_ - bytes);
+  this->entries_.push_front(Entry_{ key, plan, bytes });
+  this->index_.emplace(key, this->entries_.begin());
+  this->bytes_ += bytes;
+}
+
+
+void PlanCache::set_limit(const std::size_t limit) {
+  std::lock_guard<std::mutex> guard(this->lock_);
+  this->limit_ = limit;
+  this->evict_(limit);
+}
+
+
+void PlanCache::clear() {
+  std::lock_guard<std::mutex> guard(this->lock_);
+  this->evict_(0);
+}
+
+
+PlanCacheStats PlanCache::get_stats() const {
+  std::lock_guard<std::mutex> guard(this->lock_);
+  return PlanCacheStats{ this->hits_, this->misses_, this->evictions_,
+      this->entries_.size(), this->bytes_, this->limit_ };
+}
+
+
+void PlanCache::evict_(const std::size_t limit) {
+  // Evicted plans still in use stay alive until their holders release them
+  while (this->bytes_ > limit) {
+    const auto &entry = this->entries_.back();
+    const auto range = this->index_.equal_range(entry.key);
+    for (auto iter = range.first; iter != range.second; ++iter)
+      if (&*iter->second == &entry) {
+        this->index_.erase(iter);
+        break;
+      }
+
+    this->bytes_ -= entry.bytes;
+    this->entries_.pop_back();
+    ++this->evictions_;
+  }
+}
+
+}
@@ -0,0 +1,62 @@
+#include <hptt/util/cost_model.h>
+
+#include <cstdlib>
+#include <cstring>
+
+#include <mutex>
+#include <fstream>
+
+#include <hptt/types.h>
+#include <hptt/util/cost_model_weights.h>
+
+
+namespace hptt {
+
+static_assert(COST_MODEL_FEATURE_NUM == sizeof(COST_MODEL_WEIGHTS)
+    / sizeof(COST_MODEL_WEIGHTS[0]), "Cost model weights do not match "
+    "features, please re-train the model.");
+
+
+/*
+ * Implementation for function is_learned_model_enabled
+ */
+bool is_learned_model_enabled() {
+  static const bool enabled = [] {
+    const auto env_model = std::getenv("HPTT_COST_MODEL");
+    return nullptr != env_model and 0 == std::strcmp(env_model, "learned");
+  }();
+  return enabled;
+}
+
+
+/*
+ * Implementation for function predict_cost
+ */
+double predict_cost(const CostFeatures &features) {
+  double cost = 0.0;
+  for (TensorUInt idx = 0; idx < COST_MODEL_FEATURE_NUM; ++idx)
+    cost += COST_MODEL_WEIGHTS[idx] * features[idx];
+  return cost;
+}
+
+
+/*
+ * Implementation for function log_cost_sample
+ */
+void log_cost_sample(const CostFeatures &features, const double time_ns) {
+  static std::mutex lock;
+  static std::ofstream log_file = [] {
+    const auto env_path = std::getenv("HPTT_TUNING_LOG");
+    return nullptr == env_path ? std::ofstream()
+        : std::ofstream(env_path, std::ios::app);
+  }();
+  if (not log_file.is_open())
+    return;
+
+  std::lock_guard<std::mutex> guard(lock);
+  for (const auto feature : features)
+    log_file << feature << " ";
+  log_file << time_ns << std::endl;
+}
+
+}
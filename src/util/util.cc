@@ -1,39 +1,244 @@
 #include <hptt/util/util.h>
 
 #include <cfloat>
+#include <cstdlib>
+#include <cstring>
 
+#include <string>
 #include <vector>
 #include <chrono>
 #include <utility>
+#include <algorithm>
 #include <unordered_map>
 
 #include <hptt/types.h>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+
 
 namespace hptt {
 
 /*
  * Implementation for class TimerWrapper
  */
-TimerWrapper::TimerWrapper(TensorUInt times)
+static double get_steady_ms() {
+  return std::chrono::duration<double, std::milli>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
+#if defined(__x86_64__) || defined(__i386__)
+static double get_tsc_ms() {
+  // Milliseconds per tick are calibrated once against the steady clock
+  static const double ms_per_tick = [] {
+    const auto begin_ms = get_steady_ms();
+    const auto begin_tick = __rdtsc();
+    while (get_steady_ms() - begin_ms < 10.0)
+      continue;
+    return (get_steady_ms() - begin_ms)
+        / static_cast<double>(__rdtsc() - begin_tick);
+  }();
+  return static_cast<double>(__rdtsc()) * ms_per_tick;
+}
+#endif
+
+
+TimerWrapper::TimerWrapper(TensorUInt times, TensorIdx flush_size)
     : times_(times),
-      timeout_(-1.0) {
+      use_tsc_([] {
+        const auto env_timer = std::getenv("HPTT_TUNING_TIMER");
+        return nullptr != env_timer and 0 == std::strcmp(env_timer, "tsc");
+      }()),
+      timeout_(-1.0),
+      countdown_begin_(0.0),
+      flush_buffer_(flush_size / sizeof(double)) {
 }
 
 
 void TimerWrapper::start_countdown(const double timeout) {
   this->timeout_ = timeout;
-  this->countdown_begin_ = std::chrono::high_resolution_clock::now();
+  this->countdown_begin_ = this->now_();
 }
 
 
 bool TimerWrapper::is_timeout() const {
   if (this->timeout_ < 0.0)
     return false;
+  return this->now_() - this->countdown_begin_ >= this->timeout_;
+}
+
+
+void TimerWrapper::flush_cache_() {
+  // All threads update the buffer, so that private caches are flushed as well
+  const auto size = static_cast<TensorIdx>(this->flush_buffer_.size());
+  auto buffer = this->flush_buffer_.data();
+#pragma omp parallel for schedule(static)
+  for (TensorIdx idx = 0; idx < size; ++idx)
+    buffer[idx] = buffer[idx] * 0.5 + 1.0;
+}
+
+
+double TimerWrapper::now_() const {
+#if defined(__x86_64__) || defined(__i386__)
+  if (this->use_tsc_)
+    return get_tsc_ms();
+#endif
+  return get_steady_ms();
+}
+
+
+/*
+ * Implementation for function get_median
+ */
+double get_median(std::vector<double> values) {
+  if (values.empty())
+    return -1.0;
+
+  const auto mid = values.size() / 2;
+  std::nth_element(values.begin(), values.begin() + mid, values.end());
+  if (1 == values.size() % 2)
+    return values[mid];
+  return 0.5 * (values[mid] + *std::max_element(values.begin(),
+      values.begin() + mid));
+}
+
+
+/*
+ * Implementation for struct CacheInfo
+ */
+CacheInfo::CacheInfo()
+    : l1d_size(32 * 1024),
+      l2_size(256 * 1024),
+      l3_size(8 * 1024 * 1024),
+      line_size(64),
+      l3_sharing(1),
+      page_size(4096),
+      dtlb_entries(64),
+      stlb_entries(1536) {
+#if defined(__x86_64__) || defined(__i386__)
+  // Intel enumerates deterministic cache parameters in leaf 4, AMD uses leaf
+  // 0x8000001D with the same register layout
+  for (uint32_t leaf : { 0x4u, 0x8000001Du }) {
+    if (__get_cpuid_max(leaf & 0x80000000u, nullptr) < leaf)
+      continue;
+
+    bool found = false;
+    for (uint32_t subleaf = 0; subleaf < 16; ++subleaf) {
+      uint32_t eax, ebx, ecx, edx;
+      __cpuid_count(leaf, subleaf, eax, ebx, ecx, edx);
+
+      // Cache type 0 means no more caches, type 2 is instruction cache
+      const auto type = eax & 0x1F;
+      if (0 == type)
+        break;
+      if (2 == type)
+        continue;
+
+      const auto level = (eax >> 5) & 0x7;
+      const TensorIdx ways = ((ebx >> 22) & 0x3FF) + 1,
+          partitions = ((ebx >> 12) & 0x3FF) + 1, line = (ebx & 0xFFF) + 1,
+          sets = static_cast<TensorIdx>(ecx) + 1;
+      const auto size = ways * partitions * line * sets;
+
+      found = true;
+      if (1 == level) {
+        this->l1d_size = size;
+        this->line_size = static_cast<TensorUInt>(line);
+      }
+      else if (2 == level)
+        this->l2_size = size;
+      else if (3 == level) {
+        this->l3_size = size;
+        this->l3_sharing = ((eax >> 14) & 0xFFF) + 1;
+      }
+    }
+
+    if (found)
+      break;
+  }
+
+  // Intel enumerates TLBs in leaf 0x18, entry number is ways times sets
+  if (__get_cpuid_max(0, nullptr) >= 0x18u) {
+    uint32_t max_subleaf, ebx, ecx, edx;
+    __cpuid_count(0x18u, 0, max_subleaf, ebx, ecx, edx);
+    for (uint32_t subleaf = 0; subleaf <= max_subleaf and subleaf < 16;
+        ++subleaf) {
+      uint32_t eax;
+      __cpuid_count(0x18u, subleaf, eax, ebx, ecx, edx);
+
+      // Type 1 is data TLB, 3 is unified TLB and 4 is load only TLB, bit 0
+      // of EBX denotes 4 KiB page support
+      const auto type = edx & 0x1F, level = (edx >> 5) & 0x7;
+      if ((1 != type and 3 != type and 4 != type) or 0 == (ebx & 0x1))
+        continue;
+
+      const auto entries = static_cast<TensorIdx>(ebx >> 16) * ecx;
+      if (1 == level and 3 != type)
+        this->dtlb_entries = entries;
+      else if (2 == level)
+        this->stlb_entries = entries;
+    }
+  }
+  // AMD reports entry numbers of 4 KiB page data TLBs directly
+  else if (__get_cpuid_max(0x80000000u, nullptr) >= 0x80000006u) {
+    uint32_t eax, ebx, ecx, edx;
+    __cpuid(0x80000005u, eax, ebx, ecx, edx);
+    if (0 != ((ebx >> 16) & 0xFF))
+      this->dtlb_entries = (ebx >> 16) & 0xFF;
+    __cpuid(0x80000006u, eax, ebx, ecx, edx);
+    if (0 != ((ebx >> 16) & 0xFFF))
+      this->stlb_entries = (ebx >> 16) & 0xFFF;
+  }
+#endif
+}
+
+
+const CacheInfo &get_cache_info() {
+  static const CacheInfo info;
+  return info;
+}
+
+
+/*
+ * Implementation for function get_cpu_model and get_arch_name
+ */
+const std::string &get_cpu_model() {
+  static const std::string model = [] {
+    std::string brand;
+#if defined(__x86_64__) || defined(__i386__)
+    // Brand string is stored in leaves 0x80000002 to 0x80000004
+    if (__get_cpuid_max(0x80000000u, nullptr) >= 0x80000004u) {
+      uint32_t regs[12];
+      for (uint32_t leaf = 0; leaf < 3; ++leaf)
+        __cpuid(0x80000002u + leaf, regs[4 * leaf], regs[4 * leaf + 1],
+            regs[4 * leaf + 2], regs[4 * leaf + 3]);
+      brand.assign(reinterpret_cast<const char *>(regs), sizeof(regs));
+      brand.erase(std::find(brand.begin(), brand.end(), '\0'), brand.end());
+    }
+#endif
+    const auto first = brand.find_first_not_of(' ');
+    return std::string::npos == first ? std::string()
+        : brand.substr(first, brand.find_last_not_of(' ') - first + 1);
+  }();
+  return model;
+}
+
 
-  auto duration = std::chrono::duration_cast<Duration_>(
-      std::chrono::high_resolution_clock::now() - this->countdown_begin_);
-  return duration.count() >= this->timeout_ ? true : false;
+const char *get_arch_name() {
+#if defined(__AVX2__)
+  return "avx2";
+#elif defined(__AVX__)
+  return "avx";
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+  return "arm";
+#elif defined(__ALTIVEC__)
+  return "ibm";
+#else
+  return "common";
+#endif
 }
 
 
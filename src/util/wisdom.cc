@@ -0,0 +1,114 @@
+#include <hptt/util/wisdom.h>
+
+#include <cstdlib>
+
+#include <mutex>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <fstream>
+#include <unordered_map>
+
+#include <hptt/types.h>
+
+
+namespace hptt {
+
+/*
+ * Wisdom file format: the header line, then one entry per line as the key,
+ * the separator and the space separated descriptor code.
+ */
+constexpr char WISDOM_HEADER[] = "hptt-wisdom 1";
+constexpr char WISDOM_SEP[] = " = ";
+
+
+/*
+ * Implementation for class Wisdom
+ */
+Wisdom &Wisdom::get_wisdom() {
+  static Wisdom wisdom;
+  return wisdom;
+}
+
+
+Wisdom::Wisdom()
+    : lock_(), entries_(), default_path_() {
+  const auto env_path = std::getenv("HPTT_WISDOM");
+  if (nullptr != env_path) {
+    this->default_path_ = env_path;
+    this->import_file(this->default_path_);
+  }
+}
+
+
+bool Wisdom::lookup(const std::string &key,
+    std::vector<TensorIdx> &code) const {
+  std::lock_guard<std::mutex> guard(this->lock_);
+  const auto entry = this->entries_.find(key);
+  if (this->entries_.end() == entry)
+    return false;
+
+  code = entry->second;
+  return true;
+}
+
+
+void Wisdom::insert(const std::string &key,
+    const std::vector<TensorIdx> &code) {
+  std::lock_guard<std::mutex> guard(this->lock_);
+  this->entries_[key] = code;
+}
+
+
+bool Wisdom::import_file(const std::string &path) {
+  std::ifstream file(this->resolve_path_(path));
+  std::string line;
+  if (not file or not std::getline(file, line) or line != WISDOM_HEADER)
+    return false;
+
+  // Parse all entries before merging, a broken file changes nothing
+  std::unordered_map<std::string, std::vector<TensorIdx>> entries;
+  while (std::getline(file, line)) {
+    const auto sep_pos = line.find(WISDOM_SEP);
+    if (std::string::npos == sep_pos)
+      return false;
+
+    std::istringstream code_stream(
+        line.substr(sep_pos + sizeof(WISDOM_SEP) - 1));
+    std::vector<TensorIdx> code;
+    for (TensorIdx val; code_stream >> val; )
+      code.push_back(val);
+    if (not code_stream.eof())
+      return false;
+    entries[line.substr(0, sep_pos)] = std::move(code);
+  }
+
+  std::lock_guard<std::mutex> guard(this->lock_);
+  for (auto &entry : entries)
+    this->entries_[entry.first] = std::move(entry.second);
+  return true;
+}
+
+
+bool Wisdom::export_file(const std::string &path) const {
+  std::ofstream file(this->resolve_path_(path));
+  if (not file)
+    return false;
+
+  std::lock_guard<std::mutex> guard(this->lock_);
+  file << WISDOM_HEADER << "\n";
+  for (const auto &entry : this->entries_) {
+    file << entry.first << WISDOM_SEP;
+    for (TensorUInt idx = 0; idx < entry.second.size(); ++idx)
+      file << (0 == idx ? "" : " ") << entry.second[idx];
+    file << "\n";
+  }
+  return static_cast<bool>(file.flush());
+}
+
+
+std::string Wisdom::resolve_path_(const std::string &path) const {
+  return path.empty() ? this->default_path_ : path;
+}
+
+}
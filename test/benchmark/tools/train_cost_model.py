@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+'''
+Offline trainer of HPTT's learned cost model.
+
+The trainer runs the tuning sweep benchmark (hptt_bm_trans_sweep) with
+HPTT_TUNING_LOG set, so that every candidate timed during auto-tuning is
+logged as a sample: the candidate's features and its time per element. A
+linear model of the logarithm of time per element is fitted by ridge
+regression and written as the compiled-in weight table
+inc/hptt/util/cost_model_weights.h. Rebuild the library afterwards.
+
+Usage:
+  train_cost_model.py --bench <path/to/hptt_bm_trans_sweep> [--runs 200]
+      [--seed 0] [--timeout 2.0] [--log samples.txt] [--out weights.h]
+  train_cost_model.py --log samples.txt [--out weights.h]   (no new sweep)
+'''
+
+import os
+import sys
+import math
+import argparse
+import subprocess
+
+
+# Features constant for a problem: bias, elements, data type size, merged order,
+# common leading order, leading order sizes, threads and critical strides
+PROBLEM_FEATURES = [0, 1, 2, 3, 4, 5, 6, 9, 15]
+
+HEADER_TEMPLATE = '''#pragma once
+#ifndef HPTT_UTIL_COST_MODEL_WEIGHTS_H_
+#define HPTT_UTIL_COST_MODEL_WEIGHTS_H_
+
+/*
+ * Weights of the learned cost model, generated by
+ * test/benchmark/tools/train_cost_model.py. Do not edit.
+ */
+namespace hptt {
+
+constexpr double COST_MODEL_WEIGHTS[] = {
+%s };
+
+}
+
+#endif // HPTT_UTIL_COST_MODEL_WEIGHTS_H_
+'''
+
+
+def run_sweep(bench, runs, seed, timeout, log_path):
+  env = dict(os.environ, HPTT_TUNING_LOG=log_path)
+  subprocess.run([bench, str(runs), str(seed), str(timeout)], env=env,
+      check=True)
+
+
+def load_samples(log_path):
+  samples = []
+  with open(log_path) as log_file:
+    for line in log_file:
+      values = [float(val) for val in line.split()]
+      if len(values) < 2 or values[-1] <= 0.0:
+        continue
+      samples.append((values[:-1], math.log2(values[-1])))
+  return samples
+
+
+def solve(matrix, vector):
+  # Gaussian elimination with partial pivoting
+  dim = len(vector)
+  aug = [row[:] + [vector[idx]] for idx, row in enumerate(matrix)]
+  for col in range(dim):
+    pivot = max(range(col, dim), key=lambda row: abs(aug[row][col]))
+    aug[col], aug[pivot] = aug[pivot], aug[col]
+    for row in range(dim):
+      if row != col and 0.0 != aug[col][col]:
+        scale = aug[row][col] / aug[col][col]
+        aug[row] = [a - scale * b for a, b in zip(aug[row], aug[col])]
+  return [aug[idx][dim] / aug[idx][idx] if 0.0 != aug[idx][idx] else 0.0
+      for idx in range(dim)]
+
+
+def fit_ridge(samples, ridge, penalize_first=False):
+  # Ridge regression: (X^T X + ridge * I) w = X^T y
+  dim = len(samples[0][0])
+  xtx = [[0.0] * dim for _ in range(dim)]
+  xty = [0.0] * dim
+  for features, target in samples:
+    for row in range(dim):
+      xty[row] += features[row] * target
+      for col in range(dim):
+        xtx[row][col] += features[row] * features[col]
+  for idx in range(0 if penalize_first else 1, dim):
+    xtx[idx][idx] += ridge * len(samples)
+  return solve(xtx, xty)
+
+
+def fit(samples, ridge):
+  # The model is only used to rank candidates of one problem, so candidate
+  # weights are fitted on samples centered per problem first. Problem weights
+  # are then fitted on the per-problem mean of the remaining error, which keeps
+  # predicted times meaningful across problems.
+  groups = {}
+  for features, target in samples:
+    key = tuple(features[idx] for idx in PROBLEM_FEATURES)
+    groups.setdefault(key, []).append((features, target))
+
+  centered = []
+  for group in groups.values():
+    dim = len(group[0][0])
+    mean_x = [sum(f[idx] for f, _ in group) / len(group) for idx in range(dim)]
+    mean_y = sum(t for _, t in group) / len(group)
+    for features, target in group:
+      centered.append(([0.0 if idx in PROBLEM_FEATURES else
+          features[idx] - mean_x[idx] for idx in range(dim)],
+          target - mean_y))
+  weights = fit_ridge(centered, ridge, True)
+
+  means = []
+  for group in groups.values():
+    residual = sum(t - sum(w * f for w, f in zip(weights, features))
+        for features, t in group) / len(group)
+    means.append(([group[0][0][idx] for idx in PROBLEM_FEATURES], residual))
+  for idx, weight in zip(PROBLEM_FEATURES, fit_ridge(means, ridge)):
+    weights[idx] = weight
+  return weights
+
+
+def rank_report(samples, weights):
+  groups = {}
+  for features, target in samples:
+    key = tuple(features[idx] for idx in PROBLEM_FEATURES)
+    groups.setdefault(key, []).append((features, target))
+  hits = 0
+  for group in groups.values():
+    predicted = min(group, key=lambda sample: sum(w * f
+        for w, f in zip(weights, sample[0])))
+    hits += predicted[1] == min(target for _, target in group)
+  return len(groups), hits
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__,
+      formatter_class=argparse.RawDescriptionHelpFormatter)
+  parser.add_argument('--bench', help='path to hptt_bm_trans_sweep')
+  parser.add_argument('--runs', type=int, default=200)
+  parser.add_argument('--seed', type=int, default=0)
+  parser.add_argument('--timeout', type=float, default=2.0)
+  parser.add_argument('--ridge', type=float, default=1.0e-3)
+  parser.add_argument('--log', default='hptt_cost_samples.txt')
+  parser.add_argument('--out', default=os.path.join(os.path.dirname(
+      os.path.abspath(__file__)), '..', '..', '..', 'inc', 'hptt', 'util',
+      'cost_model_weights.h'))
+  args = parser.parse_args()
+
+  if args.bench is not None:
+    run_sweep(args.bench, args.runs, args.seed, args.timeout, args.log)
+
+  samples = load_samples(args.log)
+  if not samples:
+    sys.exit('No samples found in ' + args.log)
+  weights = fit(samples, args.ridge)
+
+  # Report fitting error
+  error = math.sqrt(sum((sum(w * f for w, f in zip(weights, features))
+      - target) ** 2 for features, target in samples) / len(samples))
+  print('Samples: %d, RMS error (log2 ns per element): %.3f' %
+      (len(samples), error))
+  print('Problems: %d, best candidate ranked first: %d' % rank_report(
+      samples, weights))
+
+  lines = []
+  for idx in range(0, len(weights), 4):
+    lines.append('  ' + ', '.join('%.9g' % w for w in weights[idx:idx + 4]))
+  with open(args.out, 'w') as out_file:
+    out_file.write(HEADER_TEMPLATE % ',\n'.join(lines))
+  print('Weights written to ' + os.path.normpath(args.out))
+
+
+if __name__ == '__main__':
+  main()
@@ -0,0 +1,77 @@
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+
+#include <vector>
+#include <random>
+#include <numeric>
+#include <algorithm>
+
+#include <hptt/hptt.h>
+#include <hptt/util/util.h>
+#include <hptt/perf-test/test_perf_util.h>
+
+using namespace std;
+using namespace hptt;
+
+
+/*
+ * Sweep over random transposes with auto-tuning, used for training the learned
+ * cost model. Run it with environment variable HPTT_TUNING_LOG set, every
+ * timed candidate is then logged as a training sample.
+ *
+ * Usage: hptt_bm_trans_sweep [problem number] [seed] [tuning timeout]
+ */
+template <typename FloatType>
+void sweep_one(mt19937 &gen, const TensorUInt bm_idx, const double timeout) {
+  // Random order, non-identity permutation and sizes of 2^18 to 2^22 elements
+  const auto order = uniform_int_distribution<TensorUInt>(2, 6)(gen);
+  vector<TensorUInt> perm(order);
+  iota(perm.begin(), perm.end(), 0);
+  while (is_sorted(perm.begin(), perm.end()))
+    shuffle(perm.begin(), perm.end(), gen);
+
+  const auto log_len = uniform_real_distribution<double>(18.0, 22.0)(gen);
+  vector<double> weights(order);
+  for (auto &weight : weights)
+    weight = uniform_real_distribution<double>(0.2, 1.0)(gen);
+  const auto weight_sum = accumulate(weights.begin(), weights.end(), 0.0);
+
+  vector<TensorUInt> size(order);
+  TensorIdx data_len = 1;
+  for (TensorUInt order_idx = 0; order_idx < order; ++order_idx) {
+    size[order_idx] = max<TensorUInt>(2, static_cast<TensorUInt>(
+        exp2(log_len * weights[order_idx] / weight_sum)));
+    data_len *= size[order_idx];
+  }
+
+  printf("|| %03d | %zu |", bm_idx, sizeof(FloatType));
+  for (auto order_idx : perm)
+    printf(" %u", order_idx);
+  printf(" |");
+  for (auto len : size)
+    printf(" %u", len);
+  fflush(stdout);
+
+  vector<FloatType> in_data(data_len), out_data(data_len);
+  auto plan = create_plan<FloatType>(in_data.data(), out_data.data(), size,
+      perm, 1, 0, 0, timeout);
+  printf(" | %s ||\n", nullptr == plan ? "skipped" : "tuned");
+}
+
+
+int main(int32_t argc, char *argv[]) {
+  const TensorUInt bm_num = argc > 1 ? atoi(argv[1]) : 100;
+  mt19937 gen(argc > 2 ? atoi(argv[2]) : 0);
+  const double timeout = argc > 3 ? atof(argv[3]) : 2.0;
+
+  print_title("Tuning sweep for learned cost model");
+  for (TensorUInt bm_idx = 0; bm_idx < bm_num; ++bm_idx) {
+    if (0 == bm_idx % 2)
+      sweep_one<float>(gen, bm_idx, timeout);
+    else
+      sweep_one<double>(gen, bm_idx, timeout);
+  }
+
+  return 0;
+}
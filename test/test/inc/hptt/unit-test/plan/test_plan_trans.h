@@ -0,0 +1,110 @@
+#pragma once
+#ifndef HPTT_UNIT_TEST_PLAN_TEST_PLAN_TRANS_H_
+#define HPTT_UNIT_TEST_PLAN_TEST_PLAN_TRANS_H_
+
+#include <array>
+#include <memory>
+#include <vector>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include <hptt/types.h>
+#include <hptt/tensor.h>
+#include <hptt/util/util.h>
+#include <hptt/param/parameter_trans.h>
+#include <hptt/cgraph/cgraph_trans.h>
+#include <hptt/plan/plan_trans.h>
+
+using namespace std;
+using namespace hptt;
+
+
+class TestPlanTransPartition : public ::testing::Test {
+protected:
+  // Create a plan without tuning, collect output cache lines written by every
+  // thread and check that each line has only one writer. Output rows are
+  // assumed to begin at line boundaries.
+  template <typename FloatType,
+            TensorUInt ORDER>
+  void check_line_owner(const array<TensorIdx, ORDER> &size,
+      const array<TensorUInt, ORDER> &perm, const TensorUInt threads) {
+    using Param = ParamTrans<TensorWrapper<FloatType, ORDER>, false>;
+
+    TensorIdx data_len = 1;
+    array<TensorIdx, ORDER> out_size;
+    for (TensorUInt idx = 0; idx < ORDER; ++idx) {
+      out_size[idx] = size[perm[idx]];
+      data_len *= size[idx];
+    }
+    vector<FloatType> in_data(data_len), out_data(data_len);
+    const TensorWrapper<FloatType, ORDER> in_tensor(TensorSize<ORDER>(size),
+        in_data.data());
+    TensorWrapper<FloatType, ORDER> out_tensor(TensorSize<ORDER>(out_size),
+        out_data.data());
+
+    auto param = make_shared<Param>(in_tensor, out_tensor, perm, 1, 0);
+    PlanTrans<Param> plan(param, threads, 0, 0, 5040, 5040, 0.0);
+    unique_ptr<CGraphTrans<Param>> graph(plan.get_graph());
+    const auto descriptor = graph->get_descriptor();
+
+    // Output stride of every merged input order
+    const auto begin = param->begin_order_idx;
+    array<TensorIdx, ORDER> out_stride{};
+    for (TensorUInt idx = begin, stride = 1; idx < ORDER; ++idx) {
+      out_stride[begin + param->perm[idx]] = stride;
+      stride *= param->output_tensor.get_outer_size(idx);
+    }
+
+    const TensorIdx line_size = get_cache_info().line_size;
+    unordered_map<TensorIdx, TensorUInt> line_owner;
+    for (TensorUInt th_idx = 0; th_idx < descriptor.description.size();
+        ++th_idx) {
+      for (const auto &loop : descriptor.description[th_idx]) {
+        bool is_empty = false;
+        for (TensorUInt order_idx = begin; order_idx < ORDER; ++order_idx)
+          is_empty = is_empty or
+              loop.loop_begin[order_idx] >= loop.loop_end[order_idx];
+        if (is_empty)
+          continue;
+
+        // Walk all elements in the region covered by this operation
+        array<TensorIdx, ORDER> idx;
+        for (TensorUInt order_idx = begin; order_idx < ORDER; ++order_idx)
+          idx[order_idx] = loop.loop_begin[order_idx];
+        for (bool walking = true; walking; ) {
+          TensorIdx offset = 0;
+          for (TensorUInt order_idx = begin; order_idx < ORDER; ++order_idx)
+            offset += idx[order_idx] * out_stride[order_idx];
+
+          const auto line = offset * sizeof(FloatType) / line_size;
+          const auto owner = line_owner.emplace(line, th_idx).first->second;
+          ASSERT_EQ(th_idx, owner) << "Cache line " << line
+              << " is written by thread " << owner << " and thread " << th_idx
+              << " (" << threads << " threads).";
+
+          walking = false;
+          for (TensorUInt order_idx = begin; order_idx < ORDER; ++order_idx) {
+            if (++idx[order_idx] < loop.loop_end[order_idx]) {
+              walking = true;
+              break;
+            }
+            idx[order_idx] = loop.loop_begin[order_idx];
+          }
+        }
+      }
+    }
+  }
+};
+
+
+TEST_F(TestPlanTransPartition, TestNoSharedCacheLine) {
+  for (TensorUInt threads = 2; threads <= 8; ++threads) {
+    this->check_line_owner<float, 2>({ 400, 208 }, { 1, 0 }, threads);
+    this->check_line_owner<float, 3>({ 96, 40, 176 }, { 2, 0, 1 }, threads);
+    this->check_line_owner<double, 2>({ 72, 136 }, { 1, 0 }, threads);
+    this->check_line_owner<double, 3>({ 40, 24, 56 }, { 1, 2, 0 }, threads);
+  }
+}
+
+#endif // HPTT_UNIT_TEST_PLAN_TEST_PLAN_TRANS_H_
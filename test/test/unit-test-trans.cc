@@ -10,6 +10,9 @@
 // Tests on transpose operations
 // #incdlue <hptt/unit-test/operations/test_operation_trans.h>
 
+// Tests on transpose plans
+#include <hptt/unit-test/plan/test_plan_trans.h>
+
 
 int main(int argc, char *argv[]) {
   ::testing::InitGoogleTest(&argc, argv);